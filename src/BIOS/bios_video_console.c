@@ -0,0 +1,164 @@
+#include "bios_video_console.h"
+#include "bios_video_services.h"
+#include "bios_video_constants.h"
+
+#define BIOS_CONSOLE_TAB    8
+
+static uint16_t blank(uint8_t attr) {
+    return (uint16_t)((uint16_t)attr << 8 | ' ');
+}
+
+static void fill(uint16_t* cell, uint16_t value, uint16_t n) {
+    while (n--) *cell++ = value;
+}
+
+// Scroll the screen up n rows (1..rows): move the rows that stay up in one pass, blank the ones uncovered
+static void scroll(bios_console_t* c, uint8_t n) {
+    uint16_t* to = c->cells;
+    const uint16_t* from = c->cells + (uint16_t)n * c->cols;
+    uint16_t keep = (uint16_t)(c->rows - n) * c->cols;
+    while (keep--) *to++ = *from++;     // forward: overlap safe
+    fill(to, blank(c->attr), (uint16_t)n * c->cols);
+}
+
+// Set the console cursor, clamped to the screen
+static void place(bios_console_t* c, uint8_t row, uint8_t col) {
+    c->row = (row < c->rows) ? row : (uint8_t)(c->rows - 1);
+    c->col = (col < c->cols) ? col : (uint8_t)(c->cols - 1);
+}
+
+// Take the BIOS cursor / hand the console cursor back, on the screen only: a host build has no BIOS
+static void cursor_in(bios_console_t* c) {
+#ifdef __LARGE__
+    if (c->hardware) {
+        bios_cursor_t cursor;
+        bios_get_cursor_position(c->page, &cursor);
+        place(c, cursor.row, cursor.column);
+    }
+#else
+    (void)c;
+#endif
+}
+
+static void cursor_out(const bios_console_t* c) {
+#ifdef __LARGE__
+    if (c->hardware) bios_set_cursor_position(c->page, c->row, c->col);
+#else
+    (void)c;
+#endif
+}
+
+void bios_console_init(bios_console_t* c, uint16_t* cells, uint8_t rows, uint8_t cols, uint8_t attr) {
+    c->cells = cells;
+    c->rows = rows;
+    c->cols = cols;
+    c->row = c->col = 0;
+    c->attr = attr;
+    c->page = 0;
+    c->hardware = false;
+}
+
+#ifdef __LARGE__
+bool bios_console_open(bios_console_t* c) {
+    bios_video_mode_t mode;
+    uint16_t segment;
+
+    bios_get_video_mode(&mode);
+    if (mode.mode <= 3) segment = BIOS_VIDEO_COLOR_SEGMENT;
+    else if (mode.mode == BIOS_VIDEO_MODE_MONO) segment = BIOS_VIDEO_MONO_SEGMENT;
+    else return false;
+
+    uint8_t rows = *(uint8_t*)BIOS_FAR(BIOS_DATA_SEGMENT, BIOS_DATA_ROWS) + 1;
+    if (rows < 25) rows = 25;           // not kept by CGA/MDA BIOSes
+    uint16_t offset = *(uint16_t*)BIOS_FAR(BIOS_DATA_SEGMENT, BIOS_DATA_PAGE_OFFSET);
+    bios_console_init(c, (uint16_t*)BIOS_FAR(segment, offset), rows, mode.columns, BIOS_VIDEO_ATTRIBUTE);
+    c->page = mode.page;
+    c->hardware = true;
+
+    cursor_in(c);
+    uint8_t attr = (uint8_t)(c->cells[(uint16_t)c->row * c->cols + c->col] >> 8);
+    if (attr) c->attr = attr;           // keep the colours on screen
+    return true;
+}
+#endif
+
+void bios_console_write(bios_console_t* c, const char* s, uint16_t n) {
+    const char* end = s + n;
+    uint16_t attr = (uint16_t)c->attr << 8;
+
+    cursor_in(c);
+    uint8_t row = c->row, col = c->col;
+    uint16_t* at = c->cells + (uint16_t)row * c->cols + col;
+
+    while (s < end) {
+        char ch = *s++;
+        bool down = false;
+        switch (ch) {
+            case '\r':
+                at -= col;
+                col = 0;
+                break;
+            case '\n':
+                down = true;
+                break;
+            case '\b':
+                if (col) {
+                    col--;
+                    at--;
+                }
+                break;
+            case '\t':
+                do {
+                    *at++ = attr | ' ';
+                } while (++col % BIOS_CONSOLE_TAB && col < c->cols);
+                break;
+            case '\a':
+                break;
+            default:
+                *at++ = attr | (uint8_t)ch;
+                col++;
+                break;
+        }
+        if (col == c->cols) {           // wrap as the teletype does
+            at -= col;
+            col = 0;
+            down = true;
+        }
+        if (!down) continue;
+
+        if (row + 1 < c->rows) {
+            row++;
+            at += c->cols;
+            continue;
+        }
+        // At the bottom: scroll once for the newlines still to come, they then land on blank rows
+        uint8_t lines = 1;
+        for (const char* p = s; p < end && lines < c->rows; p++) lines += (*p == '\n');
+        scroll(c, lines);
+        row = (uint8_t)(c->rows - lines);
+        at = c->cells + (uint16_t)row * c->cols + col;
+    }
+
+    c->row = row;
+    c->col = col;
+    cursor_out(c);
+}
+
+void bios_console_line(bios_console_t* c, uint8_t row, const char* s, uint16_t n, uint8_t attr) {
+    if (row >= c->rows) return;
+    uint16_t* at = c->cells + (uint16_t)row * c->cols;
+    uint16_t a = (uint16_t)attr << 8;
+    if (n > c->cols) n = c->cols;
+    for (uint16_t i = 0; i < n; i++) *at++ = a | (uint8_t)s[i];
+    fill(at, blank(attr), c->cols - n);
+}
+
+void bios_console_clear(bios_console_t* c) {
+    fill(c->cells, blank(c->attr), (uint16_t)c->rows * c->cols);
+    bios_console_goto(c, 0, 0);
+}
+
+void bios_console_goto(bios_console_t* c, uint8_t row, uint8_t col) {
+    place(c, row, col);
+    cursor_out(c);
+}
@@ -0,0 +1,89 @@
+/**
+ * @file bios_video_console.h
+ * @brief Text console written straight to video memory
+ *
+ * Characters go to the screen as character/attribute words stored in the
+ * text mode framebuffer (B800:0000, B000:0000 on mono), not through DOS or
+ * the BIOS teletype: no call per character and no Ctrl-C checks.
+ *
+ * @note Design Decisions:
+ *  + The console only knows a cell array (rows * cols words): on DOS it is
+ *    video memory (bios_console_open), on a host it is a plain array
+ *    (bios_console_init), so the logic is testable anywhere; without
+ *    __LARGE__ the BIOS calls are left out, and the host test builds from
+ *    test_bios_video.h and this file alone
+ *  + Own cursor: taken from the BIOS at the start of a write and handed
+ *    back at the end, so a write is one cursor read and one cursor move
+ *    however long it is, and DOS output in between (input echo) is kept
+ *  + Scrolling is a block move of the rows that stay; when a write runs
+ *    off the bottom the screen is scrolled once for all the newlines still
+ *    to come (up to a screen), not once per line
+ *  + Full screen redraws use bios_console_line: each cell is stored once,
+ *    nothing is cleared first, so there is no flicker
+ *  + Teletype controls: CR, LF (down only), BS, TAB (to a multiple of 8)
+ *    and BEL (ignored); anything else is shown as its glyph
+ *  + No retrace wait: an original IBM CGA shows snow during large writes
+ *
+ * Use it for stdout/stderr with dos_stdio_set_console():
+ *      static bios_console_t screen;
+ *      static void to_screen(void* console, const char* s, uint16_t n) { bios_console_write(console, s, n); }
+ *      if (bios_console_open(&screen)) dos_stdio_set_console(to_screen, &screen);
+ */
+#ifndef BIOS_VIDEO_CONSOLE_H
+#define BIOS_VIDEO_CONSOLE_H
+
+#ifdef USE_DOSLIBC
+    #include "../STD/dos_stdint.h"
+    #include "../STD/dos_stdbool.h"
+#else
+    #include <stdint.h>
+    #include <stdbool.h>
+#endif
+
+typedef struct {
+    uint16_t* cells;        // rows * cols character/attribute words, row by row
+    uint8_t   rows;
+    uint8_t   cols;
+    uint8_t   row;          // cursor
+    uint8_t   col;
+    uint8_t   attr;         // attribute of written text and blanked cells
+    uint8_t   page;         // BIOS display page (hardware)
+    bool      hardware;     // cells is the screen: the BIOS cursor follows the console
+} bios_console_t;
+
+/**
+ * @brief Console over a caller's cell array (e.g. a host-side stub framebuffer), cursor at 0,0
+ */
+void bios_console_init(bios_console_t* c, uint16_t* cells, uint8_t rows, uint8_t cols, uint8_t attr);
+
+#ifdef __LARGE__
+/**
+ * @brief Console over the active text mode screen, at the BIOS cursor, in the attribute found there
+ * @return false in a graphics mode
+ * @note DOS only: video memory is reached through far pointers
+ */
+bool bios_console_open(bios_console_t* c);
+#endif
+
+/**
+ * @brief Write n characters at the cursor, wrapping and scrolling as a teletype
+ */
+void bios_console_write(bios_console_t* c, const char* s, uint16_t n);
+
+/**
+ * @brief Redraw a row: n characters of s from column 0 in attr, the rest of the row blank
+ * @note characters are stored as glyphs (no controls), the cursor does not move
+ */
+void bios_console_line(bios_console_t* c, uint8_t row, const char* s, uint16_t n, uint8_t attr);
+
+/**
+ * @brief Blank the screen in the console attribute and home the cursor
+ */
+void bios_console_clear(bios_console_t* c);
+
+/**
+ * @brief Move the cursor, clamped to the screen
+ */
+void bios_console_goto(bios_console_t* c, uint8_t row, uint8_t col);
+
+#endif
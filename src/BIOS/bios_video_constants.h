@@ -0,0 +1,26 @@
+#ifndef BIOS_VIDEO_CONSTANTS_H
+#define BIOS_VIDEO_CONSTANTS_H
+
+#define BIOS_VIDEO_SERVICES    10h
+
+#define BIOS_SET_CURSOR_POSITION    2
+#define BIOS_GET_CURSOR_POSITION    3
+#define BIOS_GET_VIDEO_MODE         0Fh
+
+// Text mode video memory
+#define BIOS_VIDEO_COLOR_SEGMENT    0xB800U     // modes 0-3 (CGA, EGA, VGA)
+#define BIOS_VIDEO_MONO_SEGMENT     0xB000U     // mode 7 (MDA, Hercules)
+#define BIOS_VIDEO_MODE_MONO        7
+#define BIOS_VIDEO_ATTRIBUTE        0x07        // light grey on black
+
+// BIOS Data Area (segment 40h)
+#define BIOS_DATA_SEGMENT           0x0040U
+#define BIOS_DATA_PAGE_OFFSET       0x004EU     // word: offset of the active page in video memory
+#define BIOS_DATA_ROWS              0x0084U     // byte: rows - 1 (EGA+, 0 on CGA/MDA)
+
+// Far pointer from segment:offset (large memory model only: a host pointer is not segment:offset)
+#ifdef __LARGE__
+    #define BIOS_FAR(segment, offset)   ((void*)(((uint32_t)(segment) << 16) | (uint16_t)(offset)))
+#endif
+
+#endif
@@ -0,0 +1,88 @@
+#include "bios_video_services.h"
+#include "bios_video_constants.h"
+#include "bios_video_types.h"
+
+/**
+ * AH = 0F
+ * on return:
+ *	AH = number of screen columns
+ *	AL = mode currently set (see VIDEO MODES)
+ *	BH = current display page
+ *
+ * @note some early BIOSes destroy BP on INT 10h
+ */
+void bios_get_video_mode(bios_video_mode_t* mode) {
+    __asm {
+		.8086
+		pushf
+        push    ds
+        push    bp
+
+		mov		ah, BIOS_GET_VIDEO_MODE
+		int		BIOS_VIDEO_SERVICES
+        pop     bp
+        les     di, mode
+		stosw                               ; AL mode, AH columns
+        mov     al, bh
+        stosb
+
+		pop 	ds
+		popf
+	}
+}
+
+/**
+ * AH = 03
+ * BH = video page
+ * on return:
+ *	CH = cursor starting scan line (low order 5 bits)
+ *	CL = cursor ending scan line (low order 5 bits)
+ *	DH = row
+ *	DL = column
+ */
+void bios_get_cursor_position(unsigned char page, bios_cursor_t* cursor) {
+    __asm {
+		.8086
+		pushf
+        push    ds
+        push    bp
+
+        mov     bh, page
+		mov		ah, BIOS_GET_CURSOR_POSITION
+		int		BIOS_VIDEO_SERVICES
+        pop     bp
+        les     di, cursor
+        mov     ax, dx
+		stosw                               ; DL column, DH row
+
+		pop 	ds
+		popf
+	}
+}
+
+/**
+ * AH = 02
+ * BH = page number (0 for graphics modes)
+ * DH = row
+ * DL = column
+ *
+ * @note 0,0 is the upper left corner
+ */
+void bios_set_cursor_position(unsigned char page, unsigned char row, unsigned char column) {
+    __asm {
+		.8086
+		pushf
+        push    ds
+        push    bp
+
+        mov     bh, page
+        mov     dh, row
+        mov     dl, column
+		mov		ah, BIOS_SET_CURSOR_POSITION
+		int		BIOS_VIDEO_SERVICES
+        pop     bp
+
+		pop 	ds
+		popf
+	}
+}
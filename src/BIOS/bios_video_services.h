@@ -0,0 +1,19 @@
+/**
+* @url https://www.stanislavs.org/helppc/int_10.html
+*
+*   INT 10,2   Set cursor position
+*   INT 10,3   Read cursor position and size
+*   INT 10,F   Get video state
+*/
+#ifndef BIOS_VIDEO_SERVICES_H
+#define BIOS_VIDEO_SERVICES_H
+
+#include "bios_video_types.h"
+
+void bios_get_video_mode(bios_video_mode_t* mode);
+
+void bios_get_cursor_position(unsigned char page, bios_cursor_t* cursor);
+
+void bios_set_cursor_position(unsigned char page, unsigned char row, unsigned char column);
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef BIOS_VIDEO_TYPES_H
+#define BIOS_VIDEO_TYPES_H
+
+#pragma pack(1)
+typedef struct {
+    unsigned char mode;         // AL: video mode
+    unsigned char columns;      // AH: character columns
+    unsigned char page;         // BH: active display page
+} bios_video_mode_t;
+#pragma pack()
+
+#pragma pack(1)
+typedef struct {
+    unsigned char column;       // DL
+    unsigned char row;          // DH
+} bios_cursor_t;
+#pragma pack()
+
+#endif
@@ -397,6 +397,76 @@ END:    pop     ds
 	return errno;
 }
 
+/**
+* INT 21,44,0 - IOCTL Get Device Information
+* AH = 44h
+* AL = 00
+* BX = handle
+*
+* on return:
+* DX = device information word (see dos_device_data_word_t) if CF not set
+* AX = error code if CF set  (see DOS ERROR CODES)
+*
+* - bit 7 of DX tells a character device from a disk file; for files the low bits hold the drive
+*/
+dos_error_code_t dos_get_device_info(dos_file_handle_t fhandle, uint16_t* info) {
+    dos_error_code_t errno = 0;
+	__asm {
+		.8086
+		pushf
+        push    ds
+
+		mov		bx, fhandle
+		xor		al, al						; AL = 00 GET_DEVICE_INFO
+		mov		ah, DOS_IO_CONTROL_FOR_DEVICES
+		int		DOS_SERVICE
+		jnc		OK
+		mov		errno, ax
+		xor		dx, dx
+OK:		lds     di, info
+        mov     [di], dx
+
+END:    pop     ds
+        popf
+	}
+	return errno;
+}
+
+/**
+* INT 21,44,1 - IOCTL Set Device Information
+* AH = 44h
+* AL = 01
+* BX = handle (must be a character device)
+* DX = device information word, DH = 0
+*
+* on return:
+* AX = error code if CF set  (see DOS ERROR CODES)
+*
+* - used to switch a device between cooked and binary (raw) mode with DOS_DEV_BINARY
+* - the mode belongs to the device, not the handle: CON is shared by stdin, stdout and stderr
+*/
+dos_error_code_t dos_set_device_info(dos_file_handle_t fhandle, uint16_t info) {
+    dos_error_code_t errno = 0;
+	__asm {
+		.8086
+		pushf
+        push    ds
+
+		mov		bx, fhandle
+		mov		dx, info
+		xor		dh, dh						; DH must be 0
+		mov		al, 1						; AL = 01 SET_DEVICE_INFO
+		mov		ah, DOS_IO_CONTROL_FOR_DEVICES
+		int		DOS_SERVICE
+		jnc		END
+		mov		errno, ax
+
+END:    pop     ds
+        popf
+	}
+	return errno;
+}
+
 /**
  * INT 21,56 - Rename File
  *	AH = 56h
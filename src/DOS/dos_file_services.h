@@ -52,6 +52,10 @@ dos_error_code_t  dos_get_file_attributes(const char* path_name, dos_file_attrib
 dos_error_code_t dos_set_file_attributes(const char* path_name, dos_file_attributes_t attributes);
 
 // 44  I/O control for devices (IOCTL)
+dos_error_code_t dos_get_device_info(dos_file_handle_t fhandle, uint16_t* info);
+
+dos_error_code_t dos_set_device_info(dos_file_handle_t fhandle, uint16_t info);
+
 // 45  Duplicate file handle
 // 46  Force duplicate file handle
 // 47  Get current directory
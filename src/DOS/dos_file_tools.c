@@ -21,6 +21,7 @@ uint8_t dos_file_is_eof(dos_file_handle_t fhandle) {
     if(e) return e;
     e = dos_move_file_pointer(fhandle, 0, FSEEK_END, &j);       // get file size (seek to end)
     if(e) return e;
+    if(i == j) return 1;                                        // already at the end: nothing to restore
     e = dos_move_file_pointer(fhandle, i, FSEEK_SET, NULL);       // restore original position
     if(e) return e;
     return (i >= j);                                            // dual-seek method for reliable EOF detection
@@ -33,8 +34,10 @@ dos_error_code_t dos_file_size(dos_file_handle_t fhandle,  dos_file_size_t* size
     if(e) return e;
     e = dos_move_file_pointer(fhandle, 0, FSEEK_END, &j);                     // seek to the end
     if(e) return e;
-    e = dos_move_file_pointer(fhandle, i, FSEEK_SET, &i);                     // restore original position
-    if(e) return e;
+    if(i != j) {                                                              // at the end already: nothing to restore
+        e = dos_move_file_pointer(fhandle, i, FSEEK_SET, &i);                 // restore original position
+        if(e) return e;
+    }
     *size = j;
     return DOS_SUCCESS;
 }
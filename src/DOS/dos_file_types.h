@@ -59,24 +59,24 @@ typedef enum {
 	//IOCTL,F   Set Logical Drive (3.2+)
 } dos_ioctl_t;
 
-// DOS Device Data Word — bit masks (16-bit, bits 0 to 15)
-// Only bits 0–8 are defined; bits 9–15 are reserved (must be 0)
+// DOS Device Data Word (IOCTL 0/1, DX) for a character device — bit masks
+// Only the low byte can be set (IOCTL 1 requires DH = 0)
 typedef enum {
     DOS_DEV_STDIN       = 0x0001U,  // bit 0: standard input device
     DOS_DEV_STDOUT      = 0x0002U,  // bit 1: standard output device
     DOS_DEV_NUL         = 0x0004U,  // bit 2: NUL device
     DOS_DEV_CLOCK       = 0x0008U,  // bit 3: clock device
-    // bit 4: reserved
-    // bit 5: reserved
-    DOS_DEV_EOF_PENDING = 0x0040U,  // bit 6: EOF on input (read-only; set when Ctrl+Z is next char)
-    DOS_DEV_BINARY      = 0x0080U,  // bit 7: 1 = binary mode, 0 = text (translated) mode
-    DOS_DEV_CHAR        = 0x0100U   // bit 8: 1 = character device (always set for CON, AUX, etc.)
-    // bits 9–15: reserved, must be 0
+    // bit 4: special device (INT 29h output)
+    DOS_DEV_BINARY      = 0x0020U,  // bit 5: 1 = binary (raw) mode, 0 = cooked: Ctrl-C/S/P checks, tab expansion
+    DOS_DEV_EOF_PENDING = 0x0040U,  // bit 6: 0 = EOF on input
+    DOS_DEV_CHAR        = 0x0080U,  // bit 7: 1 = character device, 0 = disk file (other bits then differ)
+    // bits 8–13: reserved
+    DOS_DEV_IOCTL       = 0x4000U   // bit 14: device driver supports IOCTL 2/3
 } dos_device_data_word_t;
 
 typedef enum {
     DOS_STREAM_MODE_TEXT = 0,
-    DOS_STREAM_MODE_BINARY = 0x80
+    DOS_STREAM_MODE_BINARY = DOS_DEV_BINARY
 } dos_stream_mode_t;
 
 typedef enum {
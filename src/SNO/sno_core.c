@@ -6,8 +6,35 @@
  * @copyright Copyright (c) 2026 Jeremy Simon Thornton
  * @license MIT License — see LICENSE file for full terms
  */
+#define SNO_PROFILE_IMPL    // definitions below must not be redirected
 #include "sno_core.h"
 
+#ifndef POLICY_USE_DOSLIBC
+    #include <stdlib.h>     // strtod() for the hard real() cases
+#endif
+
+// Digit value of every byte: 0-9, A-F and a-f map to 0..15, X = not a digit
+#define X 0xFF
+static const unsigned char digit_value[256] = {
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0x00
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0x10
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0x20
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  X,  X,  X,  X,  X,  X,  // 0x30
+     X, 10, 11, 12, 13, 14, 15,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0x40
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0x50
+     X, 10, 11, 12, 13, 14, 15,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0x60
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0x70
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0x80
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0x90
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0xA0
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0xB0
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0xC0
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0xD0
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  // 0xE0
+     X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X,  X   // 0xF0
+};
+#undef X
+
 // Helper functions
 static bool char_in_set(char c, view_t charset) {
     cursor_t p = charset.begin;
@@ -101,6 +128,157 @@ bool num(view_t* subject, int* n) {
     return true;
 }
 
+// Accumulate digits in base (8, 10 or 16) via the digit_value table
+static bool radix(view_t* subject, unsigned int base, unsigned long* n) {
+    if (!subject || !subject->begin || !subject->end || !n) return false;
+
+    cursor_t p = subject->begin;
+    unsigned long v = 0;
+    unsigned int d;
+    while (p < subject->end && (d = digit_value[(unsigned char)*p]) < base) {
+        if (v > (~0UL - d) / base) return false;    // overflow: cursor unchanged
+        v = v * base + d;
+        p++;
+    }
+    if (p == subject->begin) return false;          // require digits
+
+    *n = v;
+    subject->begin = p;
+    return true;
+}
+
+bool hexnum(view_t* subject, unsigned long* n) {
+    return radix(subject, 16, n);
+}
+
+bool octnum(view_t* subject, unsigned long* n) {
+    return radix(subject, 8, n);
+}
+
+#ifdef POLICY_USE_DOSLIBC
+typedef double mantissa_t;              // compact: accumulate in floating point
+#else
+typedef unsigned long long mantissa_t;  // exact: up to 19 significant digits
+#endif
+
+#define MANTISSA_LIMIT  ((mantissa_t)1e18)  // digits beyond this only shift exp10
+#define EXPONENT_LIMIT  10000L              // clamp absurd exponents (result is 0 or inf)
+#define REAL_BUF_SIZE   128                 // host hard-case copy for strtod()
+#define REAL_DIGITS     (REAL_BUF_SIZE - 16)    // significant digits copied, room for sticky digit and exponent
+
+#ifdef POLICY_USE_DOSLIBC
+// Scale v by 10^e with binary powers - compact, several roundings
+static double scale10(double v, long e) {
+    static const double pow10_bin[] = {1e1, 1e2, 1e4, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256};
+    bool negative = e < 0;
+    if (negative) e = -e;
+    if (e > 511) e = 511;   // 1 <= v < 1e19: beyond this the result is already 0 or inf
+    for (unsigned int i = 0; e != 0; e >>= 1, i++)
+        if (e & 1) v = negative ? v / pow10_bin[i] : v * pow10_bin[i];
+    return v;
+}
+#else
+// Copy the mantissa of number [p, end) for strtod() as significant digits and an exponent: leading zeros and the
+// point go, digits past REAL_DIGITS become one sticky '1' (enough to round correctly unless a halfway point lies beyond)
+static void real_text(char* buf, cursor_t p, cursor_t end, long exp10) {
+    char* b = buf;
+    unsigned int kept = 0;
+    bool fraction = false, sticky = false;
+    for (; p < end && *p != 'e' && *p != 'E'; p++) {
+        if (*p == '.') { fraction = true; continue; }
+        if (kept == 0 && *p == '0') { exp10 -= fraction; continue; }
+        if (kept < REAL_DIGITS) { *b++ = *p; kept++; exp10 -= fraction; }
+        else { exp10 += !fraction; sticky |= *p != '0'; }
+    }
+    if (sticky) { *b++ = '1'; exp10--; }
+
+    *b++ = 'e';
+    if (exp10 < 0) { *b++ = '-'; exp10 = -exp10; }
+    char digits[12];
+    unsigned int n = 0;
+    do { digits[n++] = (char)('0' + exp10 % 10); exp10 /= 10; } while (exp10);
+    while (n) *b++ = digits[--n];
+    *b = '\0';
+}
+#endif
+
+bool real(view_t* subject, double* x) {
+    if (!subject || !subject->begin || !subject->end || !x ||
+        subject->begin >= subject->end) return false;  // reject empty subject
+
+    view_t temp = *subject;
+    any(&temp, "+-");  // optional sign (atomic)
+
+    cursor_t p = temp.begin;
+    mantissa_t m = 0;
+    long exp10 = 0;
+    bool inexact = false;   // a non-zero digit was dropped
+    unsigned int digits = 0;
+    unsigned int d;
+
+    // integer part
+    while (p < temp.end && (d = digit_value[(unsigned char)*p]) < 10) {
+        if (m < MANTISSA_LIMIT) m = m * 10 + d;
+        else { exp10++; inexact |= d != 0; }
+        digits++;
+        p++;
+    }
+    // fraction part
+    if (p < temp.end && *p == '.') {
+        p++;
+        while (p < temp.end && (d = digit_value[(unsigned char)*p]) < 10) {
+            if (m < MANTISSA_LIMIT) { m = m * 10 + d; exp10--; }
+            else inexact |= d != 0;
+            digits++;
+            p++;
+        }
+    }
+    if (digits == 0) return false;  // require mantissa digits
+    long scale = 0;             // written exponent
+
+    // exponent part - only consumed when digits follow the marker
+    if (p < temp.end && (*p == 'e' || *p == 'E')) {
+        view_t e = view(p + 1, temp.end);
+        bool negative = e.begin < e.end && *e.begin == '-';
+        any(&e, "+-");
+        if (e.begin < e.end && digit_value[(unsigned char)*e.begin] < 10) {
+            long n = 0;
+            while (e.begin < e.end && (d = digit_value[(unsigned char)*e.begin]) < 10) {
+                if (n < EXPONENT_LIMIT) n = n * 10 + d;
+                e.begin++;
+            }
+            scale = negative ? -n : n;
+            exp10 += scale;
+            p = e.begin;
+        }
+    }
+
+    double v;
+#ifdef POLICY_USE_DOSLIBC
+    v = scale10(m, exp10);
+#else
+    // Clinger fast path: exact mantissa and exact power of ten round once
+    static const double pow10_exact[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    if (m == 0) {
+        v = 0.0;
+    } else if (!inexact && m <= (1ULL << 53) && exp10 >= -22 && exp10 <= 22) {
+        v = exp10 < 0 ? (double)m / pow10_exact[-exp10] : (double)m * pow10_exact[exp10];
+    } else {
+        char buf[REAL_BUF_SIZE];    // hard case: defer to the correctly rounded libc
+        real_text(buf, temp.begin, p, scale);
+        v = strtod(buf, NULL);
+    }
+#endif
+    if (*subject->begin == '-') v = -v;
+
+    *x = v;
+    subject->begin = p;
+    return true;
+}
+
 //2.6
 bool nul(view_t* subject) {
     if (!subject || !subject->begin || !subject->end) return false;
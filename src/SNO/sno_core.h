@@ -117,6 +117,41 @@ bool var(view_t* subject, char* buf, size_t buflen);
  */
 bool num(view_t* subject, int* n);
 
+/**
+ * 2.5 Value Assignment through Pattern Matching
+ * Parse decimal floating point number from current cursor position
+ * Format: [sign] (digits [. [digits]] | . digits) [(e|E) [sign] digits]
+ * SUCCESS: cursor advanced past entire number, *x = parsed value
+ * FAILURE: cursor unchanged (no mantissa digits, sign or point alone)
+ * @return true on valid number, false on parse error or NULL args
+ * @note An exponent marker not followed by digits is not consumed ("2e" matches "2")
+ * @note Host: correctly rounded (exact fast path, strtod() for the hard cases); of a mantissa
+ *       longer than 112 significant digits the rest only counts as zero or not, which can misround
+ *       a value within 1e-112 of halfway between two doubles
+ * @note DOS (POLICY_USE_DOSLIBC): compact power-of-ten scaling, may differ by 1 ulp
+ */
+bool real(view_t* subject, double* x);
+
+/**
+ * 2.5 Value Assignment through Pattern Matching
+ * Parse unsigned hexadecimal integer from current cursor position
+ * Format: hex digits [0-9A-Fa-f]+ (no sign, no "0x" prefix - compose with str())
+ * SUCCESS: cursor advanced past all hex digits, *n = parsed value
+ * FAILURE: cursor unchanged (no digits, or value overflows unsigned long)
+ * @return true on valid hex integer, false on parse error or NULL args
+ */
+bool hexnum(view_t* subject, unsigned long* n);
+
+/**
+ * 2.5 Value Assignment through Pattern Matching
+ * Parse unsigned octal integer from current cursor position
+ * Format: octal digits [0-7]+ (no sign, no "0" prefix handling)
+ * SUCCESS: cursor advanced past all octal digits, *n = parsed value
+ * FAILURE: cursor unchanged (no digits, or value overflows unsigned long)
+ * @return true on valid octal integer, false on parse error or NULL args
+ */
+bool octnum(view_t* subject, unsigned long* n);
+
 /**
  * 2.6 The Null String in Pattern Matching SNOBOL NULL
  * Attempts to match the null string always succeed
@@ -221,4 +256,24 @@ bool notany(view_t* subject, const char* charset);
  */
 #define skip(subject, charset) (span((subject), (charset)) || nul((subject)))
 
+/**
+ * SNO_PROFILE: route every primitive call through the profiler (see sno_profile.h)
+ */
+#if defined(SNO_PROFILE) && !defined(SNO_PROFILE_IMPL)
+    #include "sno_profile.h"
+    #define str(s, m)       SNO_PROFILED(SNO_PROF_STR, (s), str((s), (m)))
+    #define chr(s, c)       SNO_PROFILED(SNO_PROF_CHR, (s), chr((s), (c)))
+    #define var(s, b, n)    SNO_PROFILED(SNO_PROF_VAR, (s), var((s), (b), (n)))
+    #define num(s, n)       SNO_PROFILED(SNO_PROF_NUM, (s), num((s), (n)))
+    #define real(s, x)      SNO_PROFILED(SNO_PROF_REAL, (s), real((s), (x)))
+    #define hexnum(s, n)    SNO_PROFILED(SNO_PROF_HEXNUM, (s), hexnum((s), (n)))
+    #define octnum(s, n)    SNO_PROFILED(SNO_PROF_OCTNUM, (s), octnum((s), (n)))
+    #define nul(s)          SNO_PROFILED(SNO_PROF_NUL, (s), nul((s)))
+    #define len(s, n)       SNO_PROFILED(SNO_PROF_LEN, (s), len((s), (n)))
+    #define span(s, c)      SNO_PROFILED(SNO_PROF_SPAN, (s), span((s), (c)))
+    #define brk(s, c)       SNO_PROFILED(SNO_PROF_BRK, (s), brk((s), (c)))
+    #define any(s, c)       SNO_PROFILED(SNO_PROF_ANY, (s), any((s), (c)))
+    #define notany(s, c)    SNO_PROFILED(SNO_PROF_NOTANY, (s), notany((s), (c)))
+#endif
+
 #endif
@@ -0,0 +1,173 @@
+/**
+ * @file sno_csv.c
+ * @brief SNOBOL4-C Library — Zero-Copy CSV/TSV Record Parser Implementation
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include "sno_csv.h"
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_string.h"
+#else
+    #include <string.h>
+
+    // SWAR: a byte of x is zero iff its high bit survives (x - 0x01..) & ~x
+    typedef uint64_t word_t;
+    #define ONES        0x0101010101010101ULL
+    #define HIGH_BITS   0x8080808080808080ULL
+    #define WORD        ((ptrdiff_t)sizeof(word_t))
+
+    static word_t has_byte(word_t w, word_t broadcast) {
+        word_t x = w ^ broadcast;
+        return (x - ONES) & ~x & HIGH_BITS;
+    }
+#endif
+
+// First of a, b or c at or after p, or end
+static cursor_t find3(cursor_t p, cursor_t end, char a, char b, char c) {
+#ifndef POLICY_USE_DOSLIBC
+    word_t wa = ONES * (unsigned char)a, wb = ONES * (unsigned char)b, wc = ONES * (unsigned char)c;
+    while (end - p >= WORD) {
+        word_t w;
+        memcpy(&w, p, sizeof w);
+        if (has_byte(w, wa) | has_byte(w, wb) | has_byte(w, wc)) break;
+        p += WORD;
+    }
+#endif
+    while (p < end && *p != a && *p != b && *p != c) p++;
+    return p;
+}
+
+// Closing quote of a field whose text starts at p, or NULL if unterminated
+static cursor_t closing(cursor_t p, cursor_t end, bool* escaped) {
+    for (;;) {
+#ifdef POLICY_USE_DOSLIBC
+        while (p < end && *p != '"') p++;
+        if (p == end) return NULL;
+#else
+        p = memchr(p, '"', (size_t)(end - p));
+        if (!p) return NULL;
+#endif
+        if (p + 1 < end && p[1] == '"') {
+            *escaped = true;
+            p += 2;
+            continue;
+        }
+        return p;
+    }
+}
+
+// True if p ends a field: separator, line ending or end of input
+static bool field_end(const sno_csv_t* csv, cursor_t p, cursor_t end) {
+    return p == end || *p == csv->separator || *p == '\r' || *p == '\n';
+}
+
+// Quoted field at p (on the opening quote); returns the position after the closing quote or NULL
+static cursor_t quoted(sno_csv_t* csv, cursor_t p, cursor_t end, bool keep, view_t* field) {
+    bool escaped = false;
+    cursor_t start = p + 1;
+    cursor_t close = closing(start, end, &escaped);
+    if (!close) return NULL;
+
+    p = close + 1;
+    if (!field_end(csv, p, end)) return NULL;
+
+    field->begin = start;
+    field->end = close;
+    if (escaped && keep) {
+        if (csv->scratch_size - csv->scratch_used < (size_t)(close - start)) return NULL;
+        char* out = csv->scratch + csv->scratch_used;
+        field->begin = out;
+        for (cursor_t q = start; q < close; q++) {
+            *out++ = *q;
+            if (*q == '"') q++;         // "" -> "
+        }
+        field->end = out;
+        csv->scratch_used = (size_t)(out - csv->scratch);
+    }
+    return p;
+}
+
+// Step over the rest of a row, n fields already read, without storing it: the same checks as
+// sno_csv_next() (field limit, text after a closing quote); returns its line ending or NULL
+static cursor_t skip_row(const sno_csv_t* csv, cursor_t p, cursor_t end, unsigned int n) {
+    for (;;) {
+        if (n++ == SNO_CSV_FIELDS) return NULL;
+        if (p < end && *p == '"') {
+            bool escaped;
+            p = closing(p + 1, end, &escaped);
+            if (!p || !field_end(csv, ++p, end)) return NULL;
+        } else {
+            p = find3(p, end, csv->separator, '\r', '\n');
+        }
+        if (p == end || *p != csv->separator) return p;
+        p++;
+    }
+}
+
+static bool fail(sno_csv_t* csv) {
+    csv->failed = true;
+    return false;
+}
+
+bool sno_csv_init(sno_csv_t* csv, view_t input, char separator, uint32_t columns,
+                  char* scratch, size_t scratch_size) {
+    if (!csv || !input.begin || !input.end || input.begin > input.end) return false;
+    if (separator == '"' || separator == '\r' || separator == '\n') return false;
+    if (!scratch && scratch_size) return false;
+
+    csv->input = input;
+    csv->separator = separator;
+    csv->failed = false;
+    csv->columns = columns;
+    csv->scratch = scratch;
+    csv->scratch_size = scratch_size;
+    csv->scratch_used = 0;
+    csv->rows = 0;
+    return true;
+}
+
+bool sno_csv_next(sno_csv_t* csv, sno_csv_row_t* row) {
+    if (!csv || !row || csv->failed) return false;
+
+    cursor_t p = csv->input.begin, end = csv->input.end;
+    if (p == end) return false;
+
+    char sep = csv->separator;
+    csv->scratch_used = 0;
+    unsigned int n = 0;
+    for (;;) {
+        if (n == SNO_CSV_FIELDS) return fail(csv);
+
+        bool keep = (csv->columns >> n) & 1u;
+        view_t field;
+        if (p < end && *p == '"') {
+            p = quoted(csv, p, end, keep, &field);
+            if (!p) return fail(csv);
+        } else {
+            field.begin = p;
+            p = find3(p, end, sep, '\r', '\n');
+            field.end = p;
+        }
+        if (!keep) field.begin = field.end = NULL;
+        row->fields[n++] = field;
+
+        if (p == end || *p != sep) break;
+        p++;
+        if (n < SNO_CSV_FIELDS && !(csv->columns >> n)) {
+            // No wanted column left on this row
+            p = skip_row(csv, p, end, n);
+            if (!p) return fail(csv);
+            break;
+        }
+    }
+
+    if (p < end && *p == '\r') p++;
+    if (p < end && *p == '\n') p++;
+    row->count = n;
+    csv->input.begin = p;
+    csv->rows++;
+    return true;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file sno_csv.h
+ * @brief SNOBOL4-C Library — Zero-Copy CSV/TSV Record Parser
+ *
+ * Splits delimited text (RFC 4180 quoting) into rows of field views. Each
+ * sno_csv_next() call yields one row; fields point straight into the input.
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Design Decisions:
+ *  + Zero-copy - a field is a view into the input; a quoted field is the
+ *    view between its quotes. Only a field holding an escaped quote ("")
+ *    is unescaped, into the caller's scratch buffer
+ *  + Column projection - a bit mask picks the columns to materialise;
+ *    other columns are only stepped over (never unescaped), and once the
+ *    last wanted column is read the rest of the row is stepped over field
+ *    by field, still checked like a projected row
+ *  + Separator scan - on the host 8 bytes are classified per step (SWAR:
+ *    a word is tested against separator, CR and LF at once); the DOS
+ *    build steps byte by byte
+ *  + Lines end in LF, CRLF or a lone CR; a final line needs no terminator
+ */
+#ifndef SNO_CSV_H
+#define SNO_CSV_H
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stddef.h"
+    #include "dos_stdbool.h"
+    #include "dos_stdint.h"
+#else
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdint.h>
+#endif
+
+#include "sno_types.h"
+
+#define SNO_CSV_FIELDS  32              // fields per row (one projection bit each)
+#define SNO_CSV_ALL     0xFFFFFFFFUL    // project every column
+
+/**
+ * Parser state
+ */
+typedef struct {
+    view_t        input;            // unparsed remainder (start of the failing row after an error)
+    char          separator;        // ',' for CSV, '\t' for TSV
+    bool          failed;           // malformed row: every later call fails too
+    uint32_t      columns;          // bit i set: materialise column i
+    char*         scratch;          // unescaped fields of the current row
+    size_t        scratch_size;
+    size_t        scratch_used;
+    unsigned long rows;             // rows yielded so far
+} sno_csv_t;
+
+/**
+ * One row
+ */
+typedef struct {
+    view_t       fields[SNO_CSV_FIELDS];   // unprojected columns are NULL views
+    unsigned int count;                    // fields read, up to the last projected column
+} sno_csv_row_t;
+
+/**
+ * @brief Prepare to parse input
+ * @param separator     field separator, anything but a quote, CR or LF
+ * @param columns       projection mask (SNO_CSV_ALL for every column)
+ * @param scratch       buffer for unescaped fields, may be NULL if size is 0
+ * @return true if ready, false on NULL args or a bad separator
+ * @note the input text must outlive every row yielded from it
+ */
+bool sno_csv_init(sno_csv_t* csv, view_t input, char separator, uint32_t columns,
+                  char* scratch, size_t scratch_size);
+
+/**
+ * @brief Yield the next row
+ * SUCCESS: row holds the fields, parser moves to the next line
+ * FAILURE: end of input, or a malformed row (csv->failed set: unterminated
+ *          quote, text after a closing quote, more than SNO_CSV_FIELDS fields
+ *          or scratch too small); input then still starts at that row
+ * @return true if a row was read
+ * @note unescaped fields live in scratch until the next call
+ */
+bool sno_csv_next(sno_csv_t* csv, sno_csv_row_t* row);
+
+#endif
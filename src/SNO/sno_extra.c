@@ -6,8 +6,120 @@
  * @copyright Copyright (c) 2026 Jeremy Simon Thornton
  * @license MIT License — see LICENSE file
  */
+#define SNO_PROFILE_IMPL    // definitions below must not be redirected
 #include "sno_extra.h"
 
+bool sno_tok_locate(const sno_tok_t* toks, unsigned int count, unsigned int* hint, unsigned int off, unsigned int* t) {
+    unsigned int lo = *hint, hi;
+    if (lo < count && toks[lo].at == off) { *t = lo; return true; }
+    if (++lo < count && toks[lo].at == off) { *t = *hint = lo; return true; }
+
+    lo = 0;
+    hi = count;
+    while (lo < hi) {
+        unsigned int mid = lo + (hi - lo) / 2;
+        if (toks[mid].at < off) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo == count || toks[lo].at != off) return false;
+    *t = *hint = lo;
+    return true;
+}
+
+// Entry for the delimiter at p
+static bool bal_locate(sno_bal_index_t* ix, cursor_t p, unsigned int* t) {
+    if (p < ix->base || p >= ix->end) return false;
+    return sno_tok_locate(ix->toks, ix->count, &ix->hint, (unsigned int)(p - ix->base), t);
+}
+
+bool sno_bal_index(sno_bal_index_t* ix, view_t text, char open, char close,
+                   sno_bal_tok_t* toks, unsigned int capacity) {
+    if (!ix || !toks || !text.begin || !text.end || text.begin > text.end || open == close) return false;
+
+    ix->base = text.begin;
+    ix->end = text.end;
+    ix->open = open;
+    ix->close = close;
+    ix->toks = toks;
+    ix->count = 0;
+    ix->hint = 0;
+
+    // Unclosed opens are chained through their links: no separate stack
+    unsigned int top = SNO_BAL_NONE;
+    for (cursor_t p = text.begin; p < text.end; p++) {
+        if (*p != open && *p != close) continue;
+        if (ix->count == capacity) {
+            ix->count = 0;
+            return false;
+        }
+        unsigned int t = ix->count++;
+        toks[t].at = (unsigned int)(p - text.begin);
+        if (*p == open) {
+            toks[t].link = top;
+            top = t;
+        } else if (top == SNO_BAL_NONE) {
+            toks[t].link = SNO_BAL_NONE;    // stray close
+        } else {
+            unsigned int below = toks[top].link;
+            toks[top].link = t;
+            toks[t].link = top;
+            top = below;
+        }
+    }
+    while (top != SNO_BAL_NONE) {           // opens never closed
+        unsigned int below = toks[top].link;
+        toks[top].link = SNO_BAL_NONE;
+        top = below;
+    }
+    return true;
+}
+
+cursor_t sno_bal_partner(sno_bal_index_t* ix, cursor_t p) {
+    unsigned int t;
+    if (!ix || !p || !bal_locate(ix, p, &t) || ix->toks[t].link == SNO_BAL_NONE) return NULL;
+    return ix->base + ix->toks[ix->toks[t].link].at;
+}
+
+// Close matching the open at s->begin, NULL if none in the subject: depth counts unclosed opens
+static cursor_t bal_scan(const view_t* s, char open, char close) {
+    unsigned int depth = 0;
+    for (cursor_t p = s->begin; p < s->end; p++) {
+        if (*p == close && open != close) {
+            if (--depth == 0) return p;
+        } else if (*p == open) {
+            if (open == close && depth) return p;
+            depth++;
+        }
+    }
+    return NULL;
+}
+
+bool bal(view_t* s, char open, char close) {
+    if (!s || !s->begin || !s->end || s->begin >= s->end || *s->begin != open) return false;
+
+    cursor_t p = bal_scan(s, open, close);
+    if (!p) return false;
+    s->begin = p + 1;
+    return true;
+}
+
+bool bal_ix(view_t* s, sno_bal_index_t* ix) {
+    if (!s || !ix || !s->begin || !s->end || s->begin >= s->end || *s->begin != ix->open) return false;
+
+    cursor_t p;
+    unsigned int t;
+    if (bal_locate(ix, s->begin, &t)) {
+        if (ix->toks[t].link == SNO_BAL_NONE) return false;    // never closed
+        p = ix->base + ix->toks[ix->toks[t].link].at;
+        if (p >= s->end) return false;                          // past the subject
+    } else {
+        p = bal_scan(s, ix->open, ix->close);
+        if (!p) return false;
+    }
+    s->begin = p + 1;
+    return true;
+}
+
 char* strdupl(char* dst, const char* src, unsigned int n) {
     if (!dst || !src) return NULL;
     if (n == 0) return dst;
@@ -51,9 +51,67 @@ bool rem(view_t* s);
  * @note Fails on: missing opening delimiter, unclosed opens, mismatched nesting, or EOF before close
  * @note Generalizes SNOBOL's hardcoded BAL (parentheses-only) to arbitrary delimiter pairs
  * @note Every failure path rolls back cursor completely—preserves failure contract
+ * @note bal_ix() finds the close by an index lookup instead of a scan
  */
 bool bal(view_t* s, char open, char close);
 
+/**
+ * Index entry (sno_bal_index, sno_json_index): offset from the start of the text and a link to another entry
+ */
+typedef struct {
+    unsigned int at;
+    unsigned int link;
+} sno_tok_t;
+
+/**
+ * @brief Entry at offset off in toks[0..count): *hint and the entry after it first, then a binary search
+ * @return true with *t and *hint set to the entry, false if none is at off
+ */
+bool sno_tok_locate(const sno_tok_t* toks, unsigned int count, unsigned int* hint, unsigned int off, unsigned int* t);
+
+#define SNO_BAL_NONE    ((unsigned int)~0u)     // unmatched delimiter
+
+/**
+ * Delimiter entry: link is the matching close/open entry, SNO_BAL_NONE if unmatched
+ */
+typedef sno_tok_t sno_bal_tok_t;
+
+/**
+ * Bracket partner index over one text for one delimiter pair
+ */
+typedef struct {
+    cursor_t       base;
+    cursor_t       end;
+    char           open;
+    char           close;
+    sno_bal_tok_t* toks;        // every open/close delimiter in text order
+    unsigned int   count;
+    unsigned int   hint;        // last entry used
+} sno_bal_index_t;
+
+/**
+ * @brief Pair every open delimiter in text with its close in one pass
+ * @param toks Caller array with room for every delimiter in text
+ * @return true if built (unbalanced text is fine: strays are marked SNO_BAL_NONE),
+ *         false on NULL args, open == close or more than capacity delimiters
+ * @note The index describes the text as it was: rebuild it after every edit
+ */
+bool sno_bal_index(sno_bal_index_t* ix, view_t text, char open, char close,
+                   sno_bal_tok_t* toks, unsigned int capacity);
+
+/**
+ * @brief bal() for the delimiter pair of ix, the close looked up in the index
+ * @param ix Index from sno_bal_index() (must not be NULL)
+ * @return as bal(); a cursor outside the indexed text is scanned
+ */
+bool bal_ix(view_t* s, sno_bal_index_t* ix);
+
+/**
+ * @brief Partner of the delimiter at p (close for an open, open for a close)
+ * @return partner position, or NULL if p is not an indexed delimiter or is unmatched
+ */
+cursor_t sno_bal_partner(sno_bal_index_t* ix, cursor_t p);
+
 /**
  * @brief Repeat string n times (SNOBOL DUPL)
  * @param dst Output buffer (must have space for strlen(src)*n + 1)
@@ -86,4 +144,16 @@ char* strtrim(char* dst, const char* src);
  */
 char* strreplace(char* dst, const char* src, const char* from, const char* to);
 
+/**
+ * SNO_PROFILE: route every primitive call through the profiler (see sno_profile.h)
+ */
+#if defined(SNO_PROFILE) && !defined(SNO_PROFILE_IMPL)
+    #include "sno_profile.h"
+    #define tab(s, n)       SNO_PROFILED(SNO_PROF_TAB, (s), tab((s), (n)))
+    #define rtab(s, n)      SNO_PROFILED(SNO_PROF_RTAB, (s), rtab((s), (n)))
+    #define rem(s)          SNO_PROFILED(SNO_PROF_REM, (s), rem((s)))
+    #define bal(s, o, c)    SNO_PROFILED(SNO_PROF_BAL, (s), bal((s), (o), (c)))
+    #define bal_ix(s, x)    SNO_PROFILED(SNO_PROF_BAL_IX, (s), bal_ix((s), (x)))
+#endif
+
 #endif
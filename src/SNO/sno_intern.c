@@ -0,0 +1,129 @@
+/**
+ * @file sno_intern.c
+ * @brief SNOBOL4-C Library — Symbol Interning Implementation
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include "sno_intern.h"
+#include "sno_core.h"
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stdlib.h"
+#else
+    #include <stdlib.h>
+#endif
+
+// One pass 16-bit multiplicative hash - cheap on the 8086
+static uint16_t hash(view_t name) {
+    uint16_t h = 0x811Cu;
+    for (cursor_t p = name.begin; p < name.end; p++)
+        h = (uint16_t)((h ^ (unsigned char)*p) * 0x0193u);
+    return (uint16_t)(h ^ (h >> 8));
+}
+
+// Stored symbol equals view content
+static bool same(const sno_intern_t* t, const sno_symbol_t* s, view_t name) {
+    if (s->length != size(name)) return false;
+    const char* a = t->arena + s->offset;
+    for (cursor_t p = name.begin; p < name.end; p++, a++)
+        if (*a != *p) return false;
+    return true;
+}
+
+// Slot holding name, or the empty slot where it belongs
+static uint16_t probe(const sno_intern_t* t, view_t name, uint16_t h) {
+    uint16_t i = h & t->mask;
+    while (t->slots[i]) {
+        const sno_symbol_t* s = &t->symbols[t->slots[i] - 1];
+        if (s->hash == h && same(t, s, name)) break;
+        i = (i + 1) & t->mask;
+    }
+    return i;
+}
+
+bool sno_intern_init(sno_intern_t* t, unsigned int capacity, size_t arena_size) {
+    if (!t || capacity == 0 || capacity > SNO_INTERN_MAX) return false;
+
+    unsigned long slot_count = 1;
+    while (slot_count * 3 < (unsigned long)capacity * 4) slot_count <<= 1;  // load <= 3/4
+
+    unsigned long bytes = slot_count * sizeof(uint16_t) +
+                          (unsigned long)capacity * sizeof(sno_symbol_t) + arena_size;
+    if (bytes > (size_t)-1) return false;   // one block must fit size_t (64K on DOS)
+
+    char* block = (char*)malloc((size_t)bytes);
+    if (!block) return false;
+
+    t->symbols = (sno_symbol_t*)block;  // widest alignment first
+    t->slots = (uint16_t*)(t->symbols + capacity);
+    t->arena = (char*)(t->slots + slot_count);
+    t->mask = (uint16_t)(slot_count - 1);
+    t->capacity = (uint16_t)capacity;
+    t->count = 0;
+    t->arena_size = arena_size;
+    t->arena_used = 0;
+    for (unsigned long i = 0; i < slot_count; i++) t->slots[i] = 0;
+    return true;
+}
+
+void sno_intern_free(sno_intern_t* t) {
+    if (!t) return;
+    free(t->symbols);
+    t->slots = NULL;
+    t->symbols = NULL;
+    t->arena = NULL;
+    t->count = t->capacity = t->mask = 0;
+    t->arena_size = t->arena_used = 0;
+}
+
+int sno_intern(sno_intern_t* t, view_t name) {
+    if (!t || !t->slots || !name.begin || !name.end || name.begin > name.end) return -1;
+
+    uint16_t h = hash(name);
+    uint16_t i = probe(t, name, h);
+    if (t->slots[i]) return t->slots[i] - 1;        // already interned
+
+    size_t n = size(name);
+    if (t->count == t->capacity || n > 0xFFFFu ||
+        t->arena_size - t->arena_used < n + 1) return -1;   // full
+
+    char* dst = t->arena + t->arena_used;
+    for (cursor_t p = name.begin; p < name.end; ) *dst++ = *p++;
+    *dst = '\0';
+
+    sno_symbol_t* s = &t->symbols[t->count];
+    s->offset = t->arena_used;
+    s->length = (uint16_t)n;
+    s->hash = h;
+    t->arena_used += n + 1;
+    t->slots[i] = ++t->count;
+    return t->count - 1;
+}
+
+int sno_intern_find(const sno_intern_t* t, view_t name) {
+    if (!t || !t->slots || !name.begin || !name.end || name.begin > name.end) return -1;
+    uint16_t i = probe(t, name, hash(name));
+    return t->slots[i] ? t->slots[i] - 1 : -1;
+}
+
+view_t sno_intern_name(const sno_intern_t* t, int id) {
+    if (!t || !t->slots || id < 0 || id >= t->count) return view(NULL, NULL);
+    const sno_symbol_t* s = &t->symbols[id];
+    return view(t->arena + s->offset, t->arena + s->offset + s->length);
+}
+
+bool sym(view_t* subject, const char* charset, sno_intern_t* t, int* id) {
+    if (!subject || !t) return false;
+
+    view_t temp = *subject;
+    if (!span(&temp, charset)) return false;
+
+    int k = sno_intern(t, view(subject->begin, temp.begin));
+    if (k < 0) return false;    // cursor unchanged
+
+    if (id) *id = k;
+    subject->begin = temp.begin;
+    return true;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file sno_intern.h
+ * @brief SNOBOL4-C Library — Symbol Interning for Views
+ *
+ * Maps the content of a view_t to a stable small integer id so that
+ * parsers compare symbols by id instead of by bytes. Each distinct name
+ * is stored once, null-terminated, in a bump arena.
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Design Decisions:
+ *  + One allocation holds hash slots, symbol records and arena (one far block on DOS)
+ *  + Open addressing with linear probing, load factor capped at 3/4
+ *  + Ids are dense 0..count-1 in first-seen order and never change
+ *  + No deletion - the table is reset as a whole by sno_intern_free()
+ */
+#ifndef SNO_INTERN_H
+#define SNO_INTERN_H
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stddef.h"
+    #include "dos_stdbool.h"
+    #include "dos_stdint.h"
+#else
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdint.h>
+#endif
+
+#include "sno_types.h"
+
+#define SNO_INTERN_MAX  32767   // ids must fit a signed int on DOS
+
+/**
+ * Interned name record - arena offset, byte length and cached hash
+ */
+typedef struct {
+    size_t   offset;
+    uint16_t length;
+    uint16_t hash;
+} sno_symbol_t;
+
+/**
+ * Interning table - all storage lives in the single block at symbols
+ */
+typedef struct {
+    uint16_t*     slots;        // [mask + 1] id + 1 per slot, 0 = empty
+    sno_symbol_t* symbols;      // [capacity] records indexed by id
+    char*         arena;        // [arena_size] null-terminated names
+    uint16_t      mask;         // slot count - 1 (power of two)
+    uint16_t      capacity;     // maximum number of ids
+    uint16_t      count;        // ids handed out so far
+    size_t        arena_size;
+    size_t        arena_used;
+} sno_intern_t;
+
+/**
+ * @brief Allocate an interning table
+ * @param t           table to initialize
+ * @param capacity    maximum number of distinct names (1..SNO_INTERN_MAX)
+ * @param arena_size  bytes for name storage (each name costs length + 1)
+ * @return true on success, false on bad arguments or out of memory
+ * @note Storage comes from malloc() - dos_malloc() far blocks under POLICY_USE_DOSLIBC
+ */
+bool sno_intern_init(sno_intern_t* t, unsigned int capacity, size_t arena_size);
+
+/**
+ * @brief Release table storage; all ids and name views become invalid
+ */
+void sno_intern_free(sno_intern_t* t);
+
+/**
+ * @brief Intern the content of a view
+ * @return id of the name (existing or new), -1 if full or on bad arguments
+ * @note The empty name is a valid symbol
+ */
+int sno_intern(sno_intern_t* t, view_t name);
+
+/**
+ * @brief Look up the content of a view without inserting
+ * @return id of the name, -1 if not interned
+ */
+int sno_intern_find(const sno_intern_t* t, view_t name);
+
+/**
+ * @brief Stored name for an id
+ * @return view over the arena copy (begin is a C string), or an empty NULL view for bad ids
+ */
+view_t sno_intern_name(const sno_intern_t* t, int id);
+
+/**
+ * @brief Match and intern a symbol at the cursor (anchored)
+ * Spans 1+ characters of charset and interns the spanned token.
+ * SUCCESS: cursor advanced past the symbol, *id = interned id
+ * FAILURE: cursor unchanged (no charset chars, or table full)
+ * @param subject  parsing context (mutated on success)
+ * @param charset  symbol characters, e.g. SNO_ALNUM
+ * @param t        interning table
+ * @param id       receives symbol id (may be NULL)
+ * @return true if a symbol was matched and interned
+ */
+bool sym(view_t* subject, const char* charset, sno_intern_t* t, int* id);
+
+#endif
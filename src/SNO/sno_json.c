@@ -0,0 +1,217 @@
+/**
+ * @file sno_json.c
+ * @brief SNOBOL4-C Library — JSON Structural Index and Navigation Implementation
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#define SNO_PROFILE_IMPL    // definitions below must not be redirected
+#include "sno_json.h"
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_string.h"
+#else
+    #include <string.h>
+#endif
+
+static bool space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static cursor_t skip_space(cursor_t p, cursor_t end) {
+    while (p < end && space(*p)) p++;
+    return p;
+}
+
+static char at(const sno_json_index_t* ix, unsigned int t) {
+    return ix->base[ix->toks[t].at];
+}
+
+static bool push(sno_json_index_t* ix, cursor_t p, unsigned int link) {
+    if (ix->count == ix->capacity) return false;
+    ix->toks[ix->count].at = (unsigned int)(p - ix->base);
+    ix->toks[ix->count++].link = link;
+    return true;
+}
+
+// Closing quote of a string whose text starts at p, or NULL if unterminated
+static cursor_t string_end(cursor_t p, cursor_t end) {
+    cursor_t start = p;
+    for (;;) {
+#ifdef POLICY_USE_DOSLIBC
+        while (p < end && *p != '"') p++;
+        if (p == end) return NULL;
+#else
+        p = memchr(p, '"', (size_t)(end - p));
+        if (!p) return NULL;
+#endif
+        cursor_t q = p;
+        while (q > start && q[-1] == '\\') q--;
+        if (((p - q) & 1) == 0) return p;   // even run of backslashes: not escaped
+        p++;
+    }
+}
+
+static bool build(sno_json_index_t* ix) {
+    unsigned int open = SNO_JSON_NONE;
+    for (cursor_t p = ix->base; p < ix->end; p++) {
+        switch (*p) {
+        case '{':
+        case '[':
+            if (!push(ix, p, open)) return false;   // link holds the parent until closed
+            open = ix->count - 1;
+            break;
+        case '}':
+        case ']': {
+            if (open == SNO_JSON_NONE || at(ix, open) != (*p == '}' ? '{' : '[')) return false;
+            unsigned int parent = ix->toks[open].link;
+            if (!push(ix, p, open)) return false;
+            ix->toks[open].link = ix->count - 1;
+            open = parent;
+            break;
+        }
+        case ':':
+        case ',':
+            if (!push(ix, p, open)) return false;
+            break;
+        case '"': {
+            unsigned int q = ix->count;
+            if (!push(ix, p, SNO_JSON_NONE)) return false;
+            p = string_end(p + 1, ix->end);
+            if (!p || !push(ix, p, q)) return false;
+            ix->toks[q].link = ix->count - 1;
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    return open == SNO_JSON_NONE;
+}
+
+bool sno_json_index(sno_json_index_t* ix, view_t text, sno_json_tok_t* toks, unsigned int capacity) {
+    if (!ix || !toks || !text.begin || !text.end || text.begin > text.end) return false;
+
+    ix->base = text.begin;
+    ix->end = text.end;
+    ix->toks = toks;
+    ix->capacity = capacity;
+    ix->count = 0;
+    ix->hint = 0;
+    if (!build(ix)) {
+        ix->count = 0;
+        return false;
+    }
+    return true;
+}
+
+// Entry for the structural character at p
+static bool locate(sno_json_index_t* ix, cursor_t p, unsigned int* t) {
+    if (p < ix->base || p >= ix->end) return false;
+    return sno_tok_locate(ix->toks, ix->count, &ix->hint, (unsigned int)(p - ix->base), t);
+}
+
+// Opening bracket or quote entry at p
+static bool opener(sno_json_index_t* ix, cursor_t p, unsigned int* t) {
+    if (!locate(ix, p, t)) return false;
+    char c = *p;
+    if (c == '{' || c == '[') return true;
+    return c == '"' && ix->toks[*t].link > *t;      // an opening quote links forward
+}
+
+// End of the value starting at p; *next is the entry expected at p and becomes the first entry after the value.
+// Only an opening entry (linking forward) starts a value: a closing quote is the end of one.
+static cursor_t value_end(sno_json_index_t* ix, cursor_t p, cursor_t end, unsigned int* next) {
+    unsigned int t = *next;
+    if ((*p == '{' || *p == '[' || *p == '"') && t < ix->count && ix->base + ix->toks[t].at == p &&
+        ix->toks[t].link > t) {
+        t = ix->toks[t].link;
+        *next = t + 1;
+        return ix->base + ix->toks[t].at + 1;
+    }
+    cursor_t q = p;
+    while (q < end && !space(*q) && *q != ',' && *q != ':' && *q != '}' && *q != ']' &&
+           *q != '{' && *q != '[' && *q != '"') q++;
+    return q;
+}
+
+bool jbal(view_t* subject, sno_json_index_t* ix) {
+    if (!subject || !subject->begin || !subject->end || !ix) return false;
+
+    unsigned int t;
+    if (subject->begin >= subject->end || !opener(ix, subject->begin, &t)) return false;
+    cursor_t q = ix->base + ix->toks[ix->toks[t].link].at + 1;
+    if (q > subject->end) return false;
+    ix->hint = ix->toks[t].link;
+    subject->begin = q;
+    return true;
+}
+
+bool jvalue(view_t* subject, sno_json_index_t* ix) {
+    if (!subject || !subject->begin || !subject->end || !ix) return false;
+    if (subject->begin >= subject->end) return false;
+
+    unsigned int next = SNO_JSON_NONE;
+    if (opener(ix, subject->begin, &next)) return jbal(subject, ix);
+    cursor_t q = value_end(ix, subject->begin, subject->end, &next);
+    if (q == subject->begin) return false;
+    subject->begin = q;
+    return true;
+}
+
+bool jkey(view_t* subject, sno_json_index_t* ix, const char* key) {
+    if (!subject || !subject->begin || !subject->end || !ix || !key) return false;
+
+    unsigned int t;
+    if (subject->begin >= subject->end || *subject->begin != '{' || !locate(ix, subject->begin, &t)) return false;
+
+    size_t n = strlen(key);
+    unsigned int close = ix->toks[t].link;
+    unsigned int k = t + 1;
+    while (k < close && at(ix, k) == '"') {
+        unsigned int colon = ix->toks[k].link + 1;
+        if (colon >= close || at(ix, colon) != ':') return false;
+
+        cursor_t name = ix->base + ix->toks[k].at + 1;
+        cursor_t value = skip_space(ix->base + ix->toks[colon].at + 1, ix->end);
+        if ((size_t)(ix->base + ix->toks[colon - 1].at - name) == n && memcmp(name, key, n) == 0) {
+            if (value > subject->end) return false;
+            ix->hint = colon;
+            subject->begin = value;
+            return true;
+        }
+
+        // Step over the value to the ',' or the closing brace
+        k = colon + 1;
+        value_end(ix, value, ix->end, &k);
+        if (k >= close || at(ix, k) != ',') return false;
+        k++;
+    }
+    return false;
+}
+
+bool jindex(view_t* subject, sno_json_index_t* ix, unsigned int n) {
+    if (!subject || !subject->begin || !subject->end || !ix) return false;
+
+    unsigned int t;
+    if (subject->begin >= subject->end || *subject->begin != '[' || !locate(ix, subject->begin, &t)) return false;
+
+    unsigned int close = ix->toks[t].link;
+    unsigned int k = t + 1;
+    cursor_t element = skip_space(subject->begin + 1, ix->end);
+    if (element == ix->base + ix->toks[close].at) return false;     // []
+
+    for (;;) {
+        if (n-- == 0) {
+            if (element > subject->end) return false;
+            ix->hint = k - 1;
+            subject->begin = element;
+            return true;
+        }
+        value_end(ix, element, ix->end, &k);
+        if (k >= close || at(ix, k) != ',') return false;
+        element = skip_space(ix->base + ix->toks[k].at + 1, ix->end);
+        k++;
+    }
+}
@@ -0,0 +1,115 @@
+/**
+ * @file sno_json.h
+ * @brief SNOBOL4-C Library — JSON Structural Index and Navigation
+ *
+ * sno_json_index() makes one pass over JSON text (a document or JSON lines)
+ * and records every structural character outside strings, plus the quotes
+ * that bound each string, with the position of its partner. The j*
+ * primitives then move the cursor by index lookups instead of rescanning
+ * nested text with brk()/bal().
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Design Decisions:
+ *  + One entry per structural character: its offset and a link. Brackets
+ *    and string quotes link to their partner, so skipping any container or
+ *    string is one lookup; ':' and ',' link to their enclosing bracket
+ *  + The open-bracket chain is threaded through the links while indexing:
+ *    no separate stack, no nesting limit
+ *  + The caller owns the entry array; indexing fails if it is too small
+ *  + Indexing is structural only: brackets must balance and strings must
+ *    close, but scalars and string escapes are not validated
+ *  + Lookups from a cursor try the last entry used (and the one after it)
+ *    before a binary search, so walking forward through a document is O(1)
+ *    per step
+ */
+#ifndef SNO_JSON_H
+#define SNO_JSON_H
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stddef.h"
+    #include "dos_stdbool.h"
+#else
+    #include <stddef.h>
+    #include <stdbool.h>
+#endif
+
+#include "sno_types.h"
+#include "sno_extra.h"
+
+#define SNO_JSON_NONE   ((unsigned int)~0u)     // no link (top level)
+
+/**
+ * Structural character entry: a bracket or quote links to its partner entry, ':' and ',' to the
+ * enclosing open bracket
+ */
+typedef sno_tok_t sno_json_tok_t;
+
+/**
+ * Structural index over one text
+ */
+typedef struct {
+    cursor_t        base;       // start of the indexed text
+    cursor_t        end;
+    sno_json_tok_t* toks;
+    unsigned int    capacity;
+    unsigned int    count;      // 0 after a failed build
+    unsigned int    hint;       // last entry used
+} sno_json_index_t;
+
+/**
+ * @brief Index the structure of text into toks
+ * @return true if built, false on NULL args, unbalanced or mismatched
+ *         brackets, an unterminated string or more than capacity entries
+ * @note the text must outlive the index and stay unchanged
+ */
+bool sno_json_index(sno_json_index_t* ix, view_t text, sno_json_tok_t* toks, unsigned int capacity);
+
+/**
+ * BAL over the index
+ * @brief match a whole object, array or string starting at the cursor
+ * SUCCESS: cursor advanced past the closing bracket or quote
+ * FAILURE: cursor unchanged (not at an indexed '{', '[' or '"')
+ * @return true if matched, false otherwise or on NULL arguments
+ */
+bool jbal(view_t* subject, sno_json_index_t* ix);
+
+/**
+ * @brief match one value starting at the cursor: container, string or scalar
+ * SUCCESS: cursor advanced past the value (a scalar ends at whitespace or a structural character)
+ * FAILURE: cursor unchanged (at whitespace, a separator, a closing bracket or the end)
+ * @return true if matched, false otherwise or on NULL arguments
+ */
+bool jvalue(view_t* subject, sno_json_index_t* ix);
+
+/**
+ * @brief move from an object to the value of one of its members
+ * SUCCESS: cursor moved from '{' to the first character of the value of key
+ * FAILURE: cursor unchanged (not at an indexed '{' or no such key)
+ * @note key is compared with the raw member name, escapes are not decoded
+ * @return true if found, false otherwise or on NULL arguments
+ */
+bool jkey(view_t* subject, sno_json_index_t* ix, const char* key);
+
+/**
+ * @brief move from an array to one of its elements
+ * SUCCESS: cursor moved from '[' to the first character of element n (0-indexed)
+ * FAILURE: cursor unchanged (not at an indexed '[' or fewer than n + 1 elements)
+ * @return true if found, false otherwise or on NULL arguments
+ */
+bool jindex(view_t* subject, sno_json_index_t* ix, unsigned int n);
+
+/**
+ * SNO_PROFILE: route every primitive call through the profiler (see sno_profile.h)
+ */
+#if defined(SNO_PROFILE) && !defined(SNO_PROFILE_IMPL)
+    #include "sno_profile.h"
+    #define jbal(s, x)          SNO_PROFILED(SNO_PROF_JBAL, (s), jbal((s), (x)))
+    #define jvalue(s, x)        SNO_PROFILED(SNO_PROF_JVALUE, (s), jvalue((s), (x)))
+    #define jkey(s, x, k)       SNO_PROFILED(SNO_PROF_JKEY, (s), jkey((s), (x), (k)))
+    #define jindex(s, x, n)     SNO_PROFILED(SNO_PROF_JINDEX, (s), jindex((s), (x), (n)))
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ * @file sno_keyword.c
+ * @brief SNOBOL4-C Library — Perfect Hash Keyword Recognizer Implementation
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include "sno_keyword.h"
+#include "sno_core.h"
+
+// Two independent 16-bit hashes in one pass - 16-bit multiplies suit the 8086
+static void hash2(view_t token, uint16_t seed, uint16_t* h1, uint16_t* h2) {
+    uint16_t a = seed;
+    uint16_t b = (uint16_t)(seed ^ 0x9E37u);
+    for (cursor_t p = token.begin; p < token.end; p++) {
+        a = (uint16_t)((a ^ (unsigned char)*p) * 0x0193u);
+        b = (uint16_t)((b ^ (unsigned char)*p) * 0x2B75u);
+    }
+    *h1 = (uint16_t)(a ^ (a >> 7));
+    *h2 = (uint16_t)(b ^ (b >> 9));
+}
+
+// Token equals null-terminated word
+static bool same(view_t token, const char* word) {
+    cursor_t p = token.begin;
+    while (p < token.end && *word == *p) { p++; word++; }
+    return p == token.end && *word == '\0';
+}
+
+int sno_keyword(const sno_keywords_t* kw, view_t token) {
+    if (!kw || !token.begin || !token.end || token.begin >= token.end) return -1;
+
+    uint16_t h1, h2;
+    hash2(token, kw->seed, &h1, &h2);
+    uint8_t id = kw->slots[(h2 ^ kw->disp[h1 % kw->buckets]) & kw->mask];
+    if (id == SNO_KEYWORD_NONE || !same(token, kw->words[id])) return -1;
+    return id;
+}
+
+bool kwd(view_t* subject, const char* charset, const sno_keywords_t* kw, int* id) {
+    if (!subject || !kw) return false;
+
+    view_t temp = *subject;
+    if (!span(&temp, charset)) return false;
+
+    int k = sno_keyword(kw, view(subject->begin, temp.begin));
+    if (k < 0) return false;    // cursor unchanged
+
+    if (id) *id = k;
+    subject->begin = temp.begin;
+    return true;
+}
+
+// Place every key of every bucket, largest buckets first; false if any bucket is stuck
+static bool place(const uint16_t* h1, const uint16_t* h2, unsigned int count,
+                  unsigned int buckets, unsigned int mask, uint8_t* disp, uint8_t* slots) {
+    uint8_t load[SNO_KEYWORD_SLOTS] = {0};
+    unsigned int largest = 0;
+
+    for (unsigned int i = 0; i < count; i++) {
+        unsigned int b = h1[i] % buckets;
+        if (++load[b] > largest) largest = load[b];
+    }
+    for (unsigned int s = 0; s <= mask; s++) slots[s] = SNO_KEYWORD_NONE;
+    for (unsigned int b = 0; b < buckets; b++) disp[b] = 0;
+
+    for (unsigned int n = largest; n > 0; n--) {
+        for (unsigned int b = 0; b < buckets; b++) {
+            if (load[b] != n) continue;
+
+            unsigned int d;
+            for (d = 0; d <= mask; d++) {
+                unsigned int i, j;
+                for (i = 0; i < count; i++) {       // try: all keys of bucket b land free
+                    if (h1[i] % buckets != b) continue;
+                    unsigned int s = (h2[i] ^ d) & mask;
+                    if (slots[s] != SNO_KEYWORD_NONE) break;
+                    slots[s] = (uint8_t)i;
+                }
+                if (i == count) break;              // every key placed
+                for (j = 0; j < i; j++)             // undo the partial placement
+                    if (h1[j] % buckets == b) slots[(h2[j] ^ d) & mask] = SNO_KEYWORD_NONE;
+            }
+            if (d > mask) return false;
+            disp[b] = (uint8_t)d;
+        }
+    }
+    return true;
+}
+
+bool sno_keywords_build(sno_keywords_t* kw, const char* const* words, unsigned int count,
+                        uint8_t* disp, uint8_t* slots) {
+    if (!kw || !words || !disp || !slots || count == 0 || count > SNO_KEYWORD_MAX) return false;
+
+    for (unsigned int i = 0; i < count; i++) {
+        if (!words[i] || !*words[i]) return false;
+        for (unsigned int j = 0; j < i; j++)
+            if (same(bind(words[i]), words[j])) return false;  // duplicates cannot be separated
+    }
+
+    unsigned int slot_count = 1;
+    while (slot_count < count + count / 4) slot_count <<= 1;  // load factor <= 0.8
+    if (slot_count > SNO_KEYWORD_SLOTS) slot_count = SNO_KEYWORD_SLOTS;
+    unsigned int buckets = (count + 1) / 2;
+
+    uint16_t h1[SNO_KEYWORD_MAX], h2[SNO_KEYWORD_MAX];
+    for (uint16_t seed = 1; seed != 0; seed++) {
+        for (unsigned int i = 0; i < count; i++) hash2(bind(words[i]), seed, &h1[i], &h2[i]);
+        if (place(h1, h2, count, buckets, slot_count - 1, disp, slots)) {
+            kw->seed = seed;
+            kw->buckets = (uint8_t)buckets;
+            kw->mask = (uint8_t)(slot_count - 1);
+            kw->disp = disp;
+            kw->slots = slots;
+            kw->words = words;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file sno_keyword.h
+ * @brief SNOBOL4-C Library — Perfect Hash Keyword Recognizer
+ *
+ * Classifies a token view against a fixed keyword set in O(1):
+ * one pass over the token computes two hashes, a displacement table
+ * resolves the slot, and a single comparison confirms the hit.
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Tables are normally generated at build time by TOOLS/sno_phf.c,
+ *       which emits a sno_keywords_t initializer, but sno_keywords_build()
+ *       can also construct one at runtime from caller supplied storage.
+ * @note Hash and displace: slot = (h2 ^ disp[h1 % buckets]) & mask
+ */
+#ifndef SNO_KEYWORD_H
+#define SNO_KEYWORD_H
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stddef.h"
+    #include "dos_stdbool.h"
+    #include "dos_stdint.h"
+#else
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdint.h>
+#endif
+
+#include "sno_types.h"
+
+#define SNO_KEYWORD_MAX     255     // ids 0..254 fit a byte
+#define SNO_KEYWORD_SLOTS   256     // upper bound of slot and bucket tables
+#define SNO_KEYWORD_NONE    0xFF    // empty slot
+
+/**
+ * Perfect hash over a keyword set - all tables are read-only
+ */
+typedef struct {
+    uint16_t seed;              // hash seed found by the generator
+    uint8_t  buckets;           // entries in disp
+    uint8_t  mask;              // slots - 1 (slot count is a power of two)
+    const uint8_t* disp;        // [buckets] displacement per bucket
+    const uint8_t* slots;       // [mask + 1] keyword id per slot or SNO_KEYWORD_NONE
+    const char* const* words;   // [count] keyword text indexed by id
+} sno_keywords_t;
+
+/**
+ * @brief Map a token view to its keyword id
+ * @param kw     keyword table
+ * @param token  candidate keyword (e.g. the span matched by span(&s, SNO_ALNUM))
+ * @return keyword id (index into words) or -1 if token is not a keyword
+ * @note O(1): one hash pass over the token and one comparison
+ */
+int sno_keyword(const sno_keywords_t* kw, view_t token);
+
+/**
+ * @brief Match a keyword at the cursor (anchored)
+ * Spans 1+ characters of charset then classifies the spanned token.
+ * SUCCESS: cursor advanced past the keyword, *id = keyword id
+ * FAILURE: cursor unchanged (no charset chars, or token is not a keyword)
+ * @param subject  parsing context (mutated on success)
+ * @param charset  identifier characters, e.g. SNO_ALNUM
+ * @param kw       keyword table
+ * @param id       receives keyword id (may be NULL)
+ * @return true if a whole keyword was matched
+ * @note "iffy" does not match keyword "if": the whole span must be a keyword
+ */
+bool kwd(view_t* subject, const char* charset, const sno_keywords_t* kw, int* id);
+
+/**
+ * @brief Build a perfect hash for a keyword list
+ * @param kw     table to initialize (words pointer refers to the caller's list)
+ * @param words  distinct non-empty keywords, id = index in the list
+ * @param count  number of keywords (1..SNO_KEYWORD_MAX)
+ * @param disp   caller storage of SNO_KEYWORD_SLOTS bytes
+ * @param slots  caller storage of SNO_KEYWORD_SLOTS bytes
+ * @return true on success, false on bad arguments, duplicates or no seed found
+ * @note Searches seeds until every bucket finds a collision-free displacement
+ */
+bool sno_keywords_build(sno_keywords_t* kw, const char* const* words, unsigned int count,
+                        uint8_t* disp, uint8_t* slots);
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * @file sno_lexcache.c
+ * @brief SNOBOL4-C Library — Incremental Per-Line Tokenizer Driver Implementation
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include "sno_lexcache.h"
+
+bool sno_lexcache_init(sno_lexcache_t* c, sno_lexline_t lex, void* ctx,
+                       sno_lexstate_t* start, unsigned int capacity, sno_lexstate_t initial) {
+    if (!c || !lex || !start || capacity == 0) return false;
+
+    c->lex = lex;
+    c->ctx = ctx;
+    c->start = start;
+    c->capacity = capacity;
+    c->lines = 0;
+    c->first = c->until = 0;
+    c->pending = false;
+    start[0] = initial;
+    return true;
+}
+
+// Line number after an edit of [line, line + removed) -> inserted lines, for a line past the edit
+static unsigned int shifted(unsigned int n, unsigned int line, unsigned int removed, unsigned int inserted) {
+    if (n >= line + removed) return n - removed + inserted;
+    if (n > line) return line + inserted;
+    return n;
+}
+
+bool sno_lexcache_edit(sno_lexcache_t* c, unsigned int line, unsigned int removed, unsigned int inserted) {
+    if (!c || line > c->lines || removed > c->lines - line) return false;
+    unsigned int lines = c->lines - removed + inserted;
+    if (lines < c->lines - removed || lines >= c->capacity) return false;
+
+    // Keep the states from the first line after the edit on, moved to their new line numbers;
+    // the state at the start of the edit itself does not change
+    sno_lexstate_t kept = c->start[line];
+    unsigned int from = line + removed, to = line + inserted;
+    if (to > from) {
+        for (unsigned int i = c->lines + 1; i-- > from; ) c->start[i + (to - from)] = c->start[i];
+    } else if (to < from) {
+        for (unsigned int i = from; i <= c->lines; i++) c->start[i - (from - to)] = c->start[i];
+    }
+    c->start[line] = kept;
+
+    unsigned int until = line + (inserted ? inserted : 1);
+    if (c->pending) {
+        unsigned int old = shifted(c->until, line, removed, inserted);
+        if (old > until) until = old;
+        if (c->first < line) line = c->first;
+    }
+    c->lines = lines;
+    c->first = line;
+    c->until = until;
+    c->pending = true;
+    return true;
+}
+
+unsigned int sno_lexcache_update(sno_lexcache_t* c) {
+    if (!c || !c->pending) return 0;
+
+    unsigned int n = 0;
+    for (unsigned int i = c->first; i < c->lines; i++) {
+        sno_lexstate_t end = c->lex(c->ctx, i, c->start[i]);
+        n++;
+        if (i + 1 >= c->until && c->start[i + 1] == end) break;     // converged: the rest is unchanged
+        c->start[i + 1] = end;
+    }
+    c->pending = false;
+    return n;
+}
+
+sno_lexstate_t sno_lexcache_state(const sno_lexcache_t* c, unsigned int line) {
+    if (!c || line > c->lines) return 0;
+    return c->start[line];
+}
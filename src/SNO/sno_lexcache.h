@@ -0,0 +1,92 @@
+/**
+ * @file sno_lexcache.h
+ * @brief SNOBOL4-C Library — Incremental Per-Line Tokenizer Driver
+ *
+ * A line tokenizer written with SNO primitives only needs to know the lexer
+ * state a line starts in (inside a block comment, a string, ...) to
+ * tokenize it. The cache keeps that state for the start of every line; after
+ * an edit only the changed lines are tokenized again, and the driver keeps
+ * going only while the state at the end of a line differs from the cached
+ * start state of the next one.
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Design Decisions:
+ *  + Storage agnostic - the tokenizer callback fetches line n itself (the
+ *    editor owns the text); the cache only stores states
+ *  + Edits are recorded (sno_lexcache_edit) and applied lazily by
+ *    sno_lexcache_update, so several edits between redraws cost one pass
+ *  + States after an edit are shifted, not discarded: they are what the
+ *    re-scan converges against
+ *  + Caller owns the state array (lines + 1 entries: the last is the state
+ *    at the end of the document)
+ */
+#ifndef SNO_LEXCACHE_H
+#define SNO_LEXCACHE_H
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stddef.h"
+    #include "dos_stdbool.h"
+    #include "dos_stdint.h"
+#else
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdint.h>
+#endif
+
+typedef uint16_t sno_lexstate_t;
+
+/**
+ * @brief Tokenize one line
+ * @param ctx   caller context (document, token sink)
+ * @param line  line number, 0-indexed
+ * @param state lexer state at the start of the line
+ * @return lexer state at the end of the line
+ */
+typedef sno_lexstate_t (*sno_lexline_t)(void* ctx, unsigned int line, sno_lexstate_t state);
+
+/**
+ * Per-line state cache
+ */
+typedef struct {
+    sno_lexline_t   lex;
+    void*           ctx;
+    sno_lexstate_t* start;      // start[n]: state at the start of line n
+    unsigned int    capacity;   // entries in start[]
+    unsigned int    lines;      // lines in the document
+    unsigned int    first;      // pending: first line to tokenize
+    unsigned int    until;      // pending: lines before this are tokenized even if states converge
+    bool            pending;
+} sno_lexcache_t;
+
+/**
+ * @brief Prepare an empty cache
+ * @param initial state at the start of the document
+ * @return true if ready, false on NULL args or capacity 0
+ * @note load a document with sno_lexcache_edit(c, 0, 0, lines) then sno_lexcache_update(c)
+ */
+bool sno_lexcache_init(sno_lexcache_t* c, sno_lexline_t lex, void* ctx,
+                       sno_lexstate_t* start, unsigned int capacity, sno_lexstate_t initial);
+
+/**
+ * @brief Record an edit: lines [line, line + removed) were replaced by inserted new lines
+ * @note a line changed in place is removed 1, inserted 1
+ * @return true if recorded, false on NULL, a range past the end or too many lines for the state array
+ */
+bool sno_lexcache_edit(sno_lexcache_t* c, unsigned int line, unsigned int removed, unsigned int inserted);
+
+/**
+ * @brief Tokenize the lines the recorded edits affect
+ * @return number of lines tokenized (0 if nothing was pending)
+ */
+unsigned int sno_lexcache_update(sno_lexcache_t* c);
+
+/**
+ * @brief State at the start of a line (after sno_lexcache_update), e.g. to redraw just that line
+ * @return the cached state, or 0 if line > lines
+ */
+sno_lexstate_t sno_lexcache_state(const sno_lexcache_t* c, unsigned int line);
+
+#endif
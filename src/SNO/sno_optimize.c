@@ -0,0 +1,431 @@
+/**
+ * @file sno_optimize.c
+ * @brief SNOBOL4-C Library — Compiled Pattern Optimizer Implementation
+ *
+ * Every rewrite is applied one at a time and followed by compaction (dead
+ * instructions dropped, jumps retargeted, unreferenced pool strings
+ * dropped), then the search starts again until nothing applies.
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include "sno_optimize.h"
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_string.h"
+#else
+    #include <string.h>
+#endif
+
+#define LITERAL_MAX 128     // longest fused literal
+#define NO_INDEX    0xFFFF
+
+typedef struct {
+    uint8_t b[32];
+} set_t;
+
+// ---- charsets ------------------------------------------------------------
+
+static void set_add(set_t* s, unsigned char c) {
+    s->b[c >> 3] |= (uint8_t)(1u << (c & 7));
+}
+
+static bool set_subset(const set_t* a, const set_t* b) {
+    for (unsigned int i = 0; i < 32; i++) if (a->b[i] & ~b->b[i]) return false;
+    return true;
+}
+
+static bool set_disjoint(const set_t* a, const set_t* b) {
+    for (unsigned int i = 0; i < 32; i++) if (a->b[i] & b->b[i]) return false;
+    return true;
+}
+
+static unsigned int set_size(const set_t* s) {
+    unsigned int n = 0;
+    for (unsigned int c = 0; c < 256; c++) n += (s->b[c >> 3] >> (c & 7)) & 1u;
+    return n;
+}
+
+static bool uses_pool(uint8_t op) {
+    return op == SNO_OP_STR || op == SNO_OP_ANY || op == SNO_OP_NOTANY ||
+           op == SNO_OP_SPAN || op == SNO_OP_SKIP || op == SNO_OP_BRK;
+}
+
+static bool is_jump(uint8_t op) {
+    return op == SNO_OP_CHOICE || op == SNO_OP_COMMIT || op == SNO_OP_LOOP || op == SNO_OP_JMP;
+}
+
+// Charset operand of an instruction (first byte for a literal)
+static bool operand(const sno_pattern_t* p, const sno_inst_t* i, set_t* s) {
+    memset(s, 0, sizeof *s);
+    if (i->op == SNO_OP_CHR) {
+        set_add(s, (unsigned char)i->arg);
+        return true;
+    }
+    if (!uses_pool(i->op)) return false;
+
+    const char* c = p->pool + i->arg;
+    if (i->op == SNO_OP_STR) {
+        if (*c == '\0') return false;
+        set_add(s, (unsigned char)*c);
+        return true;
+    }
+    for (; *c; c++) set_add(s, (unsigned char)*c);
+    return true;
+}
+
+// Store a charset in the pool as a string, -1 if full
+static int set_string(sno_pattern_t* p, const set_t* s) {
+    char members[256];
+    size_t n = 0;
+    for (unsigned int c = 1; c < 256; c++)
+        if (s->b[c >> 3] & (1u << (c & 7))) members[n++] = (char)c;
+    return sno_pattern_string(p, members, n);
+}
+
+// ---- compaction ----------------------------------------------------------
+
+static void compact_pool(sno_pattern_t* p) {
+    uint16_t out = 0, at = 0;
+    while (at < p->pool_used) {
+        uint16_t n = (uint16_t)(strlen(p->pool + at) + 1);
+        bool used = false;
+        for (uint16_t i = 0; i < p->count; i++) {
+            sno_inst_t* x = &p->prog[i];
+            if (uses_pool(x->op) && x->arg == at) { x->arg = out; used = true; }
+        }
+        if (used) {
+            memmove(p->pool + out, p->pool + at, n);
+            out = (uint16_t)(out + n);
+        }
+        at = (uint16_t)(at + n);
+    }
+    p->pool_used = out;
+}
+
+// Drop instructions marked dead, retarget jumps to the next live instruction
+static void compact(sno_pattern_t* p, const uint8_t* dead) {
+    uint16_t map[SNO_PATTERN_PROG + 1];
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < p->count; i++) map[i] = dead[i] ? NO_INDEX : n++;
+    map[p->count] = n;
+    for (uint16_t i = p->count; i-- > 0;) if (map[i] == NO_INDEX) map[i] = map[i + 1];
+
+    uint16_t out = 0;
+    for (uint16_t i = 0; i < p->count; i++) {
+        if (dead[i]) continue;
+        sno_inst_t x = p->prog[i];
+        if (is_jump(x.op)) x.arg = map[x.arg];
+        p->prog[out++] = x;
+    }
+    p->count = out;
+    compact_pool(p);
+}
+
+// Remove count instructions from 'from'
+static void drop(sno_pattern_t* p, uint16_t from, uint16_t count) {
+    uint8_t dead[SNO_PATTERN_PROG];
+    memset(dead, 0, sizeof dead);
+    memset(dead + from, 1, count);
+    compact(p, dead);
+}
+
+// ---- straight line pairs -------------------------------------------------
+
+static bool is_literal(const sno_pattern_t* p, const sno_inst_t* i) {
+    return (i->op == SNO_OP_CHR && i->arg != 0) || (i->op == SNO_OP_STR && p->pool[i->arg] != '\0');
+}
+
+// Copy a literal into out if it fits in room, returns its length
+static size_t literal(const sno_pattern_t* p, const sno_inst_t* i, char* out, size_t room) {
+    size_t n = i->op == SNO_OP_CHR ? 1 : strlen(p->pool + i->arg);
+    if (n > room) return n;
+    if (i->op == SNO_OP_CHR) *out = (char)i->arg;
+    else memcpy(out, p->pool + i->arg, n);
+    return n;
+}
+
+// Rewrite a so that "a b" becomes "a" alone, false if no rule applies
+static bool pair(sno_pattern_t* p, sno_inst_t* a, const sno_inst_t* b) {
+    set_t x, y;
+
+    // Anything followed by fail is irrelevant: the cursor is restored anyway
+    if (b->op == SNO_OP_FAIL && !is_jump(a->op) && a->op != SNO_OP_MATCH) {
+        a->op = SNO_OP_FAIL;
+        a->arg = 0;
+        return true;
+    }
+
+    if (is_literal(p, a) && is_literal(p, b)) {
+        char lit[LITERAL_MAX];
+        size_t n = literal(p, a, lit, LITERAL_MAX);
+        if (n > LITERAL_MAX) return false;
+        size_t m = literal(p, b, lit + n, LITERAL_MAX - n);
+        if (m > LITERAL_MAX - n) return false;
+        n += m;
+        int at = sno_pattern_string(p, lit, n);
+        if (at < 0) return false;
+        a->op = SNO_OP_STR;
+        a->arg = (uint16_t)at;
+        return true;
+    }
+
+    if (!operand(p, a, &x) || !operand(p, b, &y)) return false;
+    switch (a->op) {
+    case SNO_OP_SPAN:
+    case SNO_OP_SKIP:       // the cursor stopped on a byte outside x, or at the end
+        if (b->op == SNO_OP_SKIP && set_subset(&y, &x)) return true;
+        if ((b->op == SNO_OP_SPAN || b->op == SNO_OP_ANY || b->op == SNO_OP_CHR || b->op == SNO_OP_STR) &&
+            set_subset(&y, &x)) {
+            a->op = SNO_OP_FAIL;
+            a->arg = 0;
+            return true;
+        }
+        break;
+    case SNO_OP_ANY:
+    case SNO_OP_CHR:        // one of x, then the rest of them
+        if (b->op == SNO_OP_SKIP && set_subset(&x, &y) && set_subset(&y, &x)) {
+            a->op = SNO_OP_SPAN;
+            a->arg = b->arg;
+            return true;
+        }
+        break;
+    case SNO_OP_BRK:        // the cursor stopped on a byte of x, or at the end
+        if (b->op == SNO_OP_BRK && set_subset(&x, &y)) return true;
+        if (((b->op == SNO_OP_SPAN || b->op == SNO_OP_ANY || b->op == SNO_OP_CHR || b->op == SNO_OP_STR) &&
+             set_disjoint(&x, &y)) || (b->op == SNO_OP_NOTANY && set_subset(&x, &y))) {
+            a->op = SNO_OP_FAIL;
+            a->arg = 0;
+            return true;
+        }
+        break;
+    default:
+        break;
+    }
+    return false;
+}
+
+static bool peephole(sno_pattern_t* p) {
+    uint8_t target[SNO_PATTERN_PROG];
+    memset(target, 0, sizeof target);
+    for (uint16_t i = 0; i < p->count; i++)
+        if (is_jump(p->prog[i].op)) target[p->prog[i].arg] = 1;
+
+    for (uint16_t i = 0; i + 1 < p->count; i++) {
+        if (target[i + 1] || !pair(p, &p->prog[i], &p->prog[i + 1])) continue;
+        drop(p, (uint16_t)(i + 1), 1);
+        return true;
+    }
+    return false;
+}
+
+// ---- jumps ---------------------------------------------------------------
+
+static bool jumps(sno_pattern_t* p) {
+    for (uint16_t i = 0; i < p->count; i++) {
+        sno_inst_t* x = &p->prog[i];
+        // choice targets stay put: the commit at target - 1 pairs it with its alternative
+        if (x->op != SNO_OP_COMMIT && x->op != SNO_OP_JMP) continue;
+
+        uint16_t to = x->arg;
+        for (uint16_t hops = 0; p->prog[to].op == SNO_OP_JMP && hops < p->count; hops++) to = p->prog[to].arg;
+        if (to != x->arg) {     // thread jump chains
+            x->arg = to;
+            return true;
+        }
+        if (x->op == SNO_OP_JMP && to == i + 1) {
+            drop(p, i, 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---- choices -------------------------------------------------------------
+
+// True if [from, to) is straight line code that always succeeds
+static bool cannot_fail(const sno_pattern_t* p, uint16_t from, uint16_t to) {
+    for (uint16_t i = from; i < to; i++)
+        if (p->prog[i].op != SNO_OP_SKIP && p->prog[i].op != SNO_OP_BRK) return false;
+    return true;
+}
+
+/*
+ * An alternation chain as front ends emit it:
+ *   c: choice L1; A0; commit E; L1: choice L2; A1; commit E; L2: A2; E:
+ * Merge single charset alternatives, or reorder by first byte set.
+ */
+static bool chain(sno_pattern_t* p, uint16_t c) {
+    uint16_t start[SNO_PATTERN_PROG / 2], stop[SNO_PATTERN_PROG / 2];
+    uint16_t end = p->prog[p->prog[c].arg - 1].arg;
+    uint16_t at = c, n = 0;
+
+    while (p->prog[at].op == SNO_OP_CHOICE) {
+        uint16_t alt = p->prog[at].arg;
+        if (alt <= at + 1 || p->prog[alt - 1].op != SNO_OP_COMMIT || p->prog[alt - 1].arg != end) break;
+        start[n] = (uint16_t)(at + 1);
+        stop[n++] = (uint16_t)(alt - 1);
+        at = alt;
+    }
+    if (n == 0 || end < at) return false;
+    start[n] = at;
+    stop[n++] = end;
+
+    // a|b|[cd] -> any("abcd")
+    set_t all, one;
+    memset(&all, 0, sizeof all);
+    uint16_t k;
+    for (k = 0; k < n; k++) {
+        const sno_inst_t* i = &p->prog[start[k]];
+        if (stop[k] != start[k] + 1 || (i->op != SNO_OP_CHR && i->op != SNO_OP_ANY)) break;
+        operand(p, i, &one);
+        for (unsigned int b = 0; b < 32; b++) all.b[b] |= one.b[b];
+    }
+    if (k == n) {
+        int s = set_string(p, &all);
+        if (s < 0) return false;
+        p->prog[c].op = SNO_OP_ANY;
+        p->prog[c].arg = (uint16_t)s;
+        drop(p, (uint16_t)(c + 1), (uint16_t)(end - c - 1));
+        return true;
+    }
+
+    // Reorder only if at most one alternative can match anywhere: non-empty, disjoint first bytes
+    uint16_t width[SNO_PATTERN_PROG / 2], order[SNO_PATTERN_PROG / 2];
+    unsigned int total = 0;
+    memset(&all, 0, sizeof all);
+    for (k = 0; k < n; k++) {
+        if (!sno_pattern_first(p, start[k], stop[k], one.b)) return false;
+        width[k] = (uint16_t)set_size(&one);
+        total += width[k];
+        for (unsigned int b = 0; b < 32; b++) all.b[b] |= one.b[b];
+    }
+    if (total != set_size(&all)) return false;
+
+    bool moved = false;
+    for (k = 0; k < n; k++) {           // stable insertion sort, widest first
+        uint16_t j = k;
+        while (j > 0 && width[order[j - 1]] < width[k]) { order[j] = order[j - 1]; j--; moved = true; }
+        order[j] = k;
+    }
+    if (!moved) return false;
+
+    sno_inst_t old[SNO_PATTERN_PROG];
+    memcpy(old, p->prog, p->count * sizeof(sno_inst_t));
+    at = c;
+    for (uint16_t r = 0; r < n; r++) {
+        uint16_t alt = order[r], choice = at;
+        if (r + 1 < n) at++;
+        uint16_t base = at;     // internal jumps move with the block
+        for (uint16_t i = start[alt]; i < stop[alt]; i++) {
+            sno_inst_t x = old[i];
+            if (is_jump(x.op) && x.arg >= start[alt] && x.arg <= stop[alt])
+                x.arg = (uint16_t)(x.arg - start[alt] + base);
+            p->prog[at++] = x;
+        }
+        if (r + 1 < n) {
+            p->prog[at].op = SNO_OP_COMMIT;
+            p->prog[at++].arg = end;
+            p->prog[choice].op = SNO_OP_CHOICE;
+            p->prog[choice].arg = at;
+        }
+    }
+    return true;
+}
+
+static bool choices(sno_pattern_t* p) {
+    for (uint16_t c = 0; c < p->count; c++) {
+        sno_inst_t* x = &p->prog[c];
+        uint16_t alt = x->arg;
+        if (x->op != SNO_OP_CHOICE || alt <= c + 1) continue;
+
+        // The first alternative fails at once: go straight to the second
+        if (p->prog[c + 1].op == SNO_OP_FAIL) {
+            x->op = SNO_OP_JMP;
+            return true;
+        }
+
+        sno_inst_t* close = &p->prog[alt - 1];
+        if (close->op == SNO_OP_COMMIT) {
+            // Second alternative dead: the first cannot fail or the second fails at once
+            if (p->prog[alt].op == SNO_OP_FAIL || cannot_fail(p, (uint16_t)(c + 1), (uint16_t)(alt - 1))) {
+                close->op = SNO_OP_JMP;
+                drop(p, c, 1);
+                return true;
+            }
+            // span(s)? -> skip(s)
+            if (alt == c + 3 && close->arg == alt && p->prog[c + 1].op == SNO_OP_SPAN) {
+                x->op = SNO_OP_SKIP;
+                x->arg = p->prog[c + 1].arg;
+                drop(p, (uint16_t)(c + 1), 2);
+                return true;
+            }
+            if (chain(p, c)) return true;
+        }
+
+        // (one charset step)* -> skip(s)
+        if (close->op == SNO_OP_LOOP && close->arg == c && alt == c + 3) {
+            const sno_inst_t* body = &p->prog[c + 1];
+            int s = -1;
+            if (body->op == SNO_OP_CHR && body->arg != 0) {
+                char ch = (char)body->arg;
+                s = sno_pattern_string(p, &ch, 1);
+            } else if (body->op == SNO_OP_ANY || body->op == SNO_OP_SPAN || body->op == SNO_OP_SKIP) {
+                s = body->arg;
+            }
+            if (s >= 0) {
+                x->op = SNO_OP_SKIP;
+                x->arg = (uint16_t)s;
+                drop(p, (uint16_t)(c + 1), 2);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// ---- reachability --------------------------------------------------------
+
+static bool unreachable(sno_pattern_t* p) {
+    uint8_t dead[SNO_PATTERN_PROG];
+    uint16_t todo[2 * SNO_PATTERN_PROG + 1];
+    unsigned int n = 0;
+    memset(dead, 1, sizeof dead);
+    todo[n++] = 0;
+
+    while (n) {
+        uint16_t pc = todo[--n];
+        if (pc >= p->count || !dead[pc]) continue;
+        dead[pc] = 0;
+
+        const sno_inst_t* x = &p->prog[pc];
+        switch (x->op) {
+        case SNO_OP_MATCH:
+        case SNO_OP_FAIL:   break;
+        case SNO_OP_COMMIT:
+        case SNO_OP_JMP:    todo[n++] = x->arg; break;
+        case SNO_OP_CHOICE:
+        case SNO_OP_LOOP:   todo[n++] = x->arg; todo[n++] = (uint16_t)(pc + 1); break;
+        default:            todo[n++] = (uint16_t)(pc + 1); break;
+        }
+    }
+
+    for (uint16_t i = 0; i < p->count; i++) {
+        if (dead[i]) {
+            compact(p, dead);
+            return true;
+        }
+    }
+    return false;
+}
+
+int sno_optimize(sno_pattern_t* p) {
+    if (!sno_pattern_check(p)) return -1;
+
+    int rewrites = 0;
+    while (rewrites < 4 * SNO_PATTERN_PROG &&
+           (jumps(p) || peephole(p) || choices(p) || unreachable(p)))
+        rewrites++;
+    return rewrites;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file sno_optimize.h
+ * @brief SNOBOL4-C Library — Compiled Pattern Optimizer
+ *
+ * Rewrites a compiled pattern (sno_pattern.h) into a shorter program that
+ * matches exactly the same text, with the same possessive / ordered choice
+ * semantics. Rewrites run to a fixed point:
+ *
+ *   fuse literals       chr chr str          ->  str
+ *   merge charsets      any(s) skip(s)       ->  span(s)
+ *                       span(s) skip(t<=s)   ->  span(s)
+ *                       a|b|[cd]             ->  any("abcd")
+ *                       (a|b)*  x+?          ->  skip()
+ *   dead sequences      skip(s) span(t<=s)   ->  fail  (skip already took them)
+ *   dead branches       alternatives after one that cannot fail, or starting
+ *                       with fail, are removed with unreachable code
+ *   reorder             alternatives with disjoint first bytes, widest first
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Choice rewrites expect structured programs as front ends emit them:
+ *       every "choice L" has its "commit" or "loop" at L - 1 (sno_regex() does)
+ */
+#ifndef SNO_OPTIMIZE_H
+#define SNO_OPTIMIZE_H
+
+#include "sno_pattern.h"
+
+/**
+ * @brief Optimize a compiled pattern in place
+ * @return number of rewrites applied, -1 if p is NULL or fails sno_pattern_check()
+ */
+int sno_optimize(sno_pattern_t* p);
+
+#endif
@@ -0,0 +1,242 @@
+/**
+ * @file sno_pattern.c
+ * @brief SNOBOL4-C Library — Compiled Pattern Objects Implementation
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include "sno_pattern.h"
+#include "sno_core.h"
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_string.h"
+#else
+    #include <string.h>
+#endif
+
+void sno_pattern_init(sno_pattern_t* p) {
+    if (!p) return;
+    p->count = 0;
+    p->pool_used = 0;
+}
+
+int sno_pattern_emit(sno_pattern_t* p, sno_opcode_t op, uint16_t arg) {
+    if (!p || p->count >= SNO_PATTERN_PROG) return -1;
+    sno_inst_t* i = &p->prog[p->count];
+    i->op = (uint8_t)op;
+    i->reserved = 0;
+    i->arg = arg;
+    return p->count++;
+}
+
+int sno_pattern_string(sno_pattern_t* p, const char* s, size_t n) {
+    if (!p || (!s && n)) return -1;
+
+    // Reuse an identical string already in the pool
+    for (size_t at = 0; at < p->pool_used; at += strlen(p->pool + at) + 1)
+        if (strlen(p->pool + at) == n && memcmp(p->pool + at, s, n) == 0) return (int)at;
+
+    if (n + 1 > (size_t)(SNO_PATTERN_POOL - p->pool_used)) return -1;
+    int at = p->pool_used;
+    memcpy(p->pool + at, s, n);
+    p->pool[at + n] = '\0';
+    p->pool_used = (uint16_t)(at + n + 1);
+    return at;
+}
+
+#define NO_DEPTH    0xFF
+
+// Record the choice stack depth at pc (the end of the program is a plain failure); false if it differs
+static bool reach(const sno_pattern_t* p, uint8_t depth[], uint16_t pc, uint8_t d) {
+    if (pc == p->count) return true;
+    if (depth[pc] == NO_DEPTH) depth[pc] = d;
+    return depth[pc] == d;
+}
+
+// Explicit jump target of instruction pc, p->count if it has none
+static uint16_t target(const sno_pattern_t* p, uint16_t pc) {
+    switch (p->prog[pc].op) {
+    case SNO_OP_CHOICE:
+    case SNO_OP_COMMIT:
+    case SNO_OP_LOOP:
+    case SNO_OP_JMP:    return p->prog[pc].arg;
+    default:            return p->count;
+    }
+}
+
+// Every path reaches an instruction with the same number of choices stacked, and each LOOP closes
+// its own CHOICE: L: CHOICE E; body; LOOP L; E: where the body is entered only through L, jumps
+// only within itself and never pops L's entry. Jumps are forward otherwise, so each run ends.
+static bool check_stack(const sno_pattern_t* p) {
+    uint8_t depth[SNO_PATTERN_PROG];
+    memset(depth, NO_DEPTH, sizeof depth);
+    depth[0] = 0;
+
+    // Forward edges only: every path into pc is seen before pc
+    for (uint16_t pc = 0; pc < p->count; pc++) {
+        const sno_inst_t* i = &p->prog[pc];
+        uint8_t d = depth[pc];
+        if (d == NO_DEPTH) continue;            // unreachable (optimizer leftovers)
+        switch (i->op) {
+        case SNO_OP_MATCH:
+        case SNO_OP_FAIL:   break;
+        case SNO_OP_CHOICE:
+            if (!reach(p, depth, (uint16_t)(pc + 1), (uint8_t)(d + 1)) || !reach(p, depth, i->arg, d)) return false;
+            break;
+        case SNO_OP_COMMIT: if (d == 0 || !reach(p, depth, i->arg, (uint8_t)(d - 1))) return false; break;
+        case SNO_OP_JMP:    if (!reach(p, depth, i->arg, d)) return false; break;
+        case SNO_OP_LOOP:
+            if (d == 0 || p->prog[i->arg].op != SNO_OP_CHOICE || p->prog[i->arg].arg != pc + 1 ||
+                depth[i->arg] != d - 1 || !reach(p, depth, (uint16_t)(pc + 1), (uint8_t)(d - 1))) return false;
+            break;
+        default:            if (!reach(p, depth, (uint16_t)(pc + 1), d)) return false; break;
+        }
+    }
+
+    for (uint16_t pc = 0; pc < p->count; pc++) {
+        if (p->prog[pc].op != SNO_OP_LOOP || depth[pc] == NO_DEPTH) continue;
+        uint16_t open = p->prog[pc].arg;
+        for (uint16_t x = 0; x < p->count; x++) {
+            if (depth[x] == NO_DEPTH || x == open || x == pc) continue;
+            bool inside = x > open && x < pc;
+            uint16_t to = target(p, x);
+            if (to != p->count && inside != (to > open && to <= pc)) return false;     // in or out of the body
+            if (inside && (p->prog[x].op == SNO_OP_COMMIT || p->prog[x].op == SNO_OP_LOOP) &&
+                depth[x] <= depth[pc]) return false;                                    // would pop L's entry
+        }
+    }
+    return true;
+}
+
+bool sno_pattern_check(const sno_pattern_t* p) {
+    if (!p || p->count == 0 || p->count > SNO_PATTERN_PROG || p->pool_used > SNO_PATTERN_POOL) return false;
+    if (p->pool_used && p->pool[p->pool_used - 1] != '\0') return false;
+
+    for (uint16_t pc = 0; pc < p->count; pc++) {
+        const sno_inst_t* i = &p->prog[pc];
+        switch (i->op) {
+        case SNO_OP_MATCH:
+        case SNO_OP_BOL:
+        case SNO_OP_EOL:
+        case SNO_OP_FAIL:   break;
+        case SNO_OP_CHR:    if (i->arg > 0xFF) return false; break;
+        case SNO_OP_STR:
+        case SNO_OP_ANY:
+        case SNO_OP_NOTANY:
+        case SNO_OP_SPAN:
+        case SNO_OP_SKIP:
+        case SNO_OP_BRK:    if (i->arg >= p->pool_used) return false; break;
+        case SNO_OP_LOOP:   if (i->arg >= pc) return false; break;
+        case SNO_OP_CHOICE:
+        case SNO_OP_COMMIT:
+        case SNO_OP_JMP:    if (i->arg >= p->count || i->arg <= pc) return false; break;
+        default:            return false;
+        }
+    }
+    return check_stack(p);
+}
+
+static void first_add(uint8_t first[32], const char* set, bool complement) {
+    uint8_t bits[32];
+    memset(bits, 0, sizeof bits);
+    for (; *set; set++) bits[(unsigned char)*set >> 3] |= (uint8_t)(1u << ((unsigned char)*set & 7));
+    for (unsigned int i = 0; i < 32; i++) first[i] |= complement ? (uint8_t)~bits[i] : bits[i];
+}
+
+bool sno_pattern_first(const sno_pattern_t* p, uint16_t pc, uint16_t end, uint8_t first[32]) {
+    if (!p || !first) return false;
+    memset(first, 0, 32);
+
+    // Depth first over both sides of every branch, each instruction once
+    uint8_t seen[SNO_PATTERN_PROG / 8];
+    uint16_t todo[SNO_PATTERN_PROG];
+    unsigned int n = 0;
+    memset(seen, 0, sizeof seen);
+    todo[n++] = pc;
+
+    while (n) {
+        pc = todo[--n];
+        if (pc >= p->count || pc == end) return false;
+        if (seen[pc >> 3] & (1u << (pc & 7))) continue;
+        seen[pc >> 3] |= (uint8_t)(1u << (pc & 7));
+
+        const sno_inst_t* i = &p->prog[pc];
+        const char* pool = p->pool + (i->arg < SNO_PATTERN_POOL ? i->arg : 0);
+        switch (i->op) {
+        case SNO_OP_CHR:    first[(uint8_t)i->arg >> 3] |= (uint8_t)(1u << (i->arg & 7)); break;
+        case SNO_OP_STR:
+            if (*pool) first[(unsigned char)*pool >> 3] |= (uint8_t)(1u << ((unsigned char)*pool & 7));
+            else todo[n++] = (uint16_t)(pc + 1);
+            break;
+        case SNO_OP_ANY:
+        case SNO_OP_SPAN:   first_add(first, pool, false); break;
+        case SNO_OP_NOTANY: first_add(first, pool, true); break;
+        case SNO_OP_SKIP:   first_add(first, pool, false); todo[n++] = (uint16_t)(pc + 1); break;
+        case SNO_OP_BOL:
+        case SNO_OP_EOL:    todo[n++] = (uint16_t)(pc + 1); break;
+        case SNO_OP_CHOICE:
+        case SNO_OP_LOOP:   todo[n++] = (uint16_t)(pc + 1); todo[n++] = i->arg; break;
+        case SNO_OP_COMMIT:
+        case SNO_OP_JMP:    todo[n++] = i->arg; break;
+        case SNO_OP_FAIL:   break;
+        default:            return false;   // MATCH reachable empty, BRK may stop anywhere
+        }
+        if (n + 2 > SNO_PATTERN_PROG) return false;
+    }
+    return true;
+}
+
+bool sno_exec(const sno_pattern_t* p, view_t* subject, cursor_t origin) {
+    if (!p || !subject || !subject->begin || !subject->end || p->count == 0) return false;
+
+    struct { uint16_t alt; cursor_t cursor; } stack[SNO_PATTERN_STACK];
+    unsigned int sp = 0;
+    uint16_t pc = 0;
+    view_t s = *subject;
+
+    for (;;) {
+        if (pc >= p->count) return false;   // malformed program
+        const sno_inst_t* i = &p->prog[pc++];
+        const char* pool = p->pool + (i->arg < SNO_PATTERN_POOL ? i->arg : 0);
+        bool ok = true;
+
+        switch (i->op) {
+        case SNO_OP_MATCH:  subject->begin = s.begin; return true;
+        case SNO_OP_STR:    ok = str(&s, pool); break;
+        case SNO_OP_CHR:    ok = chr(&s, (char)i->arg); break;
+        case SNO_OP_ANY:    ok = any(&s, pool); break;
+        case SNO_OP_NOTANY: ok = notany(&s, pool); break;
+        case SNO_OP_SPAN:   ok = span(&s, pool); break;
+        case SNO_OP_SKIP:   ok = skip(&s, pool); break;
+        case SNO_OP_BRK:    ok = brk(&s, pool); break;
+        case SNO_OP_BOL:    ok = s.begin == origin || s.begin[-1] == '\n'; break;
+        case SNO_OP_EOL:    ok = s.begin == s.end || *s.begin == '\n'; break;
+        case SNO_OP_CHOICE:
+            if (sp == SNO_PATTERN_STACK) { ok = false; break; }     // too deep: fail this branch
+            stack[sp].alt = i->arg;
+            stack[sp++].cursor = s.begin;
+            break;
+        case SNO_OP_COMMIT:
+            if (sp) sp--;
+            pc = i->arg;
+            break;
+        case SNO_OP_LOOP:       // an iteration that consumed nothing ends the loop
+            if (sp && s.begin != stack[--sp].cursor) pc = i->arg;
+            break;
+        case SNO_OP_JMP:    pc = i->arg; break;
+        case SNO_OP_FAIL:   ok = false; break;
+        default:            return false;
+        }
+
+        if (!ok) {
+            if (sp == 0) return false;      // cursor unchanged
+            s.begin = stack[--sp].cursor;
+            pc = stack[sp].alt;
+        }
+    }
+}
+
+bool pat(view_t* subject, const sno_pattern_t* p) {
+    return subject && sno_exec(p, subject, subject->begin);
+}
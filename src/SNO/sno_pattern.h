@@ -0,0 +1,132 @@
+/**
+ * @file sno_pattern.h
+ * @brief SNOBOL4-C Library — Compiled Pattern Objects
+ *
+ * A compiled pattern is a small program whose instructions are the core
+ * primitives (str, chr, any, notany, span, skip, brk) plus ordered choice.
+ * Front ends such as sno_regex() build it; pat() runs it like any other
+ * primitive.
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Design Decisions:
+ *  + Possessive repetition - runs compile to span()/skip()/brk(), never give back
+ *  + Ordered choice - an alternative that matches is committed (PEG semantics),
+ *    a failed alternative rolls the cursor back (Failure Contract)
+ *  + Pointer-free fixed layout - instructions index a pool of null-terminated
+ *    literals and charsets, so a pattern can be copied, saved or mapped as bytes
+ */
+#ifndef SNO_PATTERN_H
+#define SNO_PATTERN_H
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stddef.h"
+    #include "dos_stdbool.h"
+    #include "dos_stdint.h"
+#else
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdint.h>
+#endif
+
+#include "sno_types.h"
+
+#define SNO_PATTERN_PROG    128     // instructions per pattern
+#define SNO_PATTERN_POOL    1024    // bytes of literals and charsets
+#define SNO_PATTERN_STACK   32      // nested choices alive at run time
+
+/**
+ * Instruction set - arg is a pool offset, a character or a jump target
+ */
+typedef enum {
+    SNO_OP_MATCH,       // success: commit cursor
+    SNO_OP_STR,         // str(pool + arg)
+    SNO_OP_CHR,         // chr(arg)
+    SNO_OP_ANY,         // any(pool + arg)
+    SNO_OP_NOTANY,      // notany(pool + arg)
+    SNO_OP_SPAN,        // span(pool + arg)
+    SNO_OP_SKIP,        // skip(pool + arg)
+    SNO_OP_BRK,         // brk(pool + arg)
+    SNO_OP_BOL,         // at origin or just after '\n'
+    SNO_OP_EOL,         // at end or just before '\n'
+    SNO_OP_CHOICE,      // push (arg, cursor): on failure resume at arg
+    SNO_OP_COMMIT,      // pop choice, jump to arg
+    SNO_OP_LOOP,        // pop choice, jump to arg if the cursor moved since the push
+    SNO_OP_JMP,         // jump to arg
+    SNO_OP_FAIL         // always fails (left by the optimizer in dead sequences)
+} sno_opcode_t;
+
+typedef struct {
+    uint8_t  op;
+    uint8_t  reserved;
+    uint16_t arg;
+} sno_inst_t;
+
+/**
+ * Compiled pattern - contains no pointers
+ */
+typedef struct {
+    uint16_t   count;                   // instructions used
+    uint16_t   pool_used;               // pool bytes used
+    sno_inst_t prog[SNO_PATTERN_PROG];
+    char       pool[SNO_PATTERN_POOL];
+} sno_pattern_t;
+
+/**
+ * @brief Empty a pattern (no program: matches nothing until a front end emits SNO_OP_MATCH)
+ */
+void sno_pattern_init(sno_pattern_t* p);
+
+/**
+ * @brief Append an instruction
+ * @return index of the instruction, or -1 if the program is full
+ */
+int sno_pattern_emit(sno_pattern_t* p, sno_opcode_t op, uint16_t arg);
+
+/**
+ * @brief Store a null-terminated literal or charset in the pool (shared if already present)
+ * @return pool offset, or -1 if the pool is full
+ */
+int sno_pattern_string(sno_pattern_t* p, const char* s, size_t n);
+
+/**
+ * @brief Verify a pattern that came from outside (file, mapped memory) is safe to run
+ * @return true if every opcode, jump target and pool reference is in range,
+ *         every pool string is terminated, and the choices nest as the front
+ *         ends emit them: every path reaches an instruction with the same
+ *         choice stack depth, jumps go forward, and a SNO_OP_LOOP goes back
+ *         only to the CHOICE whose alternative follows it, over a body that is
+ *         entered only through that CHOICE and never pops its entry. Each run
+ *         then ends: a loop iteration consumes input and leaves no choice behind
+ */
+bool sno_pattern_check(const sno_pattern_t* p);
+
+/**
+ * @brief Bytes that can start a match of the program from instruction pc
+ * @param end    reaching this instruction counts as an empty match (p->count: whole program)
+ * @param first  256-bit set, bit c set if a match can begin with byte c
+ * @return false if a match can begin with anything or be empty (first is then meaningless)
+ */
+bool sno_pattern_first(const sno_pattern_t* p, uint16_t pc, uint16_t end, uint8_t first[32]);
+
+/**
+ * @brief Run a pattern at the cursor
+ * SUCCESS: cursor advanced past the match
+ * FAILURE: cursor unchanged
+ * @param origin  start of the text, for '^' (may be subject->begin)
+ * @return true on match, false on mismatch or NULL args
+ */
+bool sno_exec(const sno_pattern_t* p, view_t* subject, cursor_t origin);
+
+/**
+ * @brief Match a compiled pattern (anchored primitive)
+ * SUCCESS: cursor advanced past the match
+ * FAILURE: cursor unchanged
+ * @return true on match, false on mismatch or NULL args
+ * @note '^' holds at the cursor itself
+ */
+bool pat(view_t* subject, const sno_pattern_t* p);
+
+#endif
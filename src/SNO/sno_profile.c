@@ -0,0 +1,76 @@
+/**
+ * @file sno_profile.c
+ * @brief SNOBOL4-C Library — Per-Primitive Instrumentation Implementation
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include "sno_profile.h"
+
+#ifdef SNO_PROFILE
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stdio.h"
+#else
+    #include <stdio.h>
+#endif
+
+#define SNO_PROF_DEPTH  16  // nested profiled calls (primitive arguments that call primitives)
+
+sno_prof_counter_t sno_profile[SNO_PROF_COUNT];
+
+static const char* const names[SNO_PROF_COUNT] = {
+    "str", "chr", "var", "num",
+    "real", "hexnum", "octnum", "nul",
+    "len", "span", "brk", "any", "notany",
+    "tab", "rtab", "rem", "bal", "bal_ix",
+    "ulen", "uany", "uspan",
+    "jbal", "jvalue", "jkey", "jindex"
+};
+
+static cursor_t entry[SNO_PROF_DEPTH];
+static unsigned int depth;
+
+void sno_prof_enter(const view_t* subject) {
+    if (depth < SNO_PROF_DEPTH) entry[depth] = subject ? subject->begin : NULL;
+    depth++;
+}
+
+bool sno_prof_leave(sno_prof_id_t id, const view_t* subject, bool matched) {
+    cursor_t begin = (depth && --depth < SNO_PROF_DEPTH) ? entry[depth] : NULL;
+    sno_prof_counter_t* c = &sno_profile[id];
+
+    c->calls++;
+    if (matched) {
+        c->hits++;
+        if (begin && subject && subject->begin > begin)
+            c->bytes += (unsigned long)(subject->begin - begin);
+    } else {
+        c->misses++;
+    }
+    return matched;
+}
+
+void sno_profile_dump(void) {
+    unsigned long total = 0;
+    for (unsigned int i = 0; i < SNO_PROF_COUNT; i++) total += sno_profile[i].calls;
+
+    // tab separated: no field widths needed from the DOS printf
+    printf("primitive\tcalls\thits\tmisses\tbytes\t%%calls\n");
+    for (unsigned int i = 0; i < SNO_PROF_COUNT; i++) {
+        const sno_prof_counter_t* c = &sno_profile[i];
+        if (c->calls == 0) continue;
+        printf("%s\t%lu\t%lu\t%lu\t%lu\t%lu\n", names[i],
+               c->calls, c->hits, c->misses, c->bytes, c->calls * 100UL / total);
+    }
+    printf("total\t%lu\n", total);
+}
+
+void sno_profile_reset(void) {
+    for (unsigned int i = 0; i < SNO_PROF_COUNT; i++)
+        sno_profile[i].calls = sno_profile[i].hits = sno_profile[i].misses = sno_profile[i].bytes = 0;
+    depth = 0;
+}
+
+#endif // SNO_PROFILE
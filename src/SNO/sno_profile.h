@@ -0,0 +1,85 @@
+/**
+ * @file sno_profile.h
+ * @brief SNOBOL4-C Library — Per-Primitive Hot Path Instrumentation
+ *
+ * Compile everything with -DSNO_PROFILE to count, for every pattern
+ * primitive: calls, successes, failures and bytes the cursor advanced.
+ * Without SNO_PROFILE nothing here generates code (zero overhead).
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Design Decisions:
+ *  + Counting happens at the call site: sno_core.h / sno_extra.h redirect
+ *    each primitive through SNO_PROFILED(), the library bodies are untouched
+ *  + Library internal calls (num() calling span()) are not counted, only
+ *    the calls a pattern makes - which is what a hot path profile needs
+ *  + Under SNO_PROFILE the subject argument is evaluated more than once,
+ *    so it must be free of side effects (it nearly always is: &s)
+ */
+#ifndef SNO_PROFILE_H
+#define SNO_PROFILE_H
+
+#ifdef SNO_PROFILE
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stdbool.h"
+#else
+    #include <stdbool.h>
+#endif
+
+#include "sno_types.h"
+
+/**
+ * Profiled primitives
+ */
+typedef enum {
+    SNO_PROF_STR, SNO_PROF_CHR, SNO_PROF_VAR, SNO_PROF_NUM,
+    SNO_PROF_REAL, SNO_PROF_HEXNUM, SNO_PROF_OCTNUM, SNO_PROF_NUL,
+    SNO_PROF_LEN, SNO_PROF_SPAN, SNO_PROF_BRK, SNO_PROF_ANY, SNO_PROF_NOTANY,
+    SNO_PROF_TAB, SNO_PROF_RTAB, SNO_PROF_REM, SNO_PROF_BAL, SNO_PROF_BAL_IX,
+    SNO_PROF_ULEN, SNO_PROF_UANY, SNO_PROF_USPAN,
+    SNO_PROF_JBAL, SNO_PROF_JVALUE, SNO_PROF_JKEY, SNO_PROF_JINDEX,
+    SNO_PROF_COUNT
+} sno_prof_id_t;
+
+/**
+ * Counters of one primitive
+ */
+typedef struct {
+    unsigned long calls;
+    unsigned long hits;     // returned true
+    unsigned long misses;   // returned false
+    unsigned long bytes;    // cursor advance summed over hits
+} sno_prof_counter_t;
+
+extern sno_prof_counter_t sno_profile[SNO_PROF_COUNT];
+
+/**
+ * Call wrapper halves - enter saves the cursor, leave counts and passes the result through
+ */
+void sno_prof_enter(const view_t* subject);
+bool sno_prof_leave(sno_prof_id_t id, const view_t* subject, bool matched);
+
+/**
+ * @brief Print a table of every primitive that was called, with its share of calls
+ */
+void sno_profile_dump(void);
+
+/**
+ * @brief Zero all counters
+ */
+void sno_profile_reset(void);
+
+#define SNO_PROFILED(id, subject, call) \
+    (sno_prof_enter(subject), sno_prof_leave((id), (subject), (call)))
+
+#else
+
+#define sno_profile_dump()  ((void)0)
+#define sno_profile_reset() ((void)0)
+
+#endif // SNO_PROFILE
+
+#endif
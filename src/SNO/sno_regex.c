@@ -0,0 +1,322 @@
+/**
+ * @file sno_regex.c
+ * @brief SNOBOL4-C Library — Regular Expression Subset Front End Implementation
+ *
+ * Recursive descent: alt := seq ('|' seq)*, seq := (atom quant?)*.
+ * A single character atom is held as a charset until its quantifier is
+ * known, so runs map directly onto primitives:
+ *
+ *   atom    x       x*      x+              x?
+ *   c       chr     skip    span            choice chr commit
+ *   [set]   any     skip    span            choice any commit
+ *   [^set]  notany  brk     notany + brk    choice notany commit
+ *
+ * Groups compile to choice / commit / loop code.
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include "sno_regex.h"
+#include "sno_constants.h"
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_string.h"
+#else
+    #include <string.h>
+#endif
+
+#define WORD    SNO_ALNUM "_"
+#define SPACE   " \t\r\n\f\v"
+
+typedef struct {
+    sno_pattern_t* p;
+    const char*    re;      // next regex character
+    unsigned int   depth;   // open groups
+} compiler_t;
+
+typedef struct {
+    uint8_t bits[32];
+    bool    negated;
+} class_t;
+
+typedef enum { ATOM_NONE, ATOM_CLASS, ATOM_CODE, ATOM_ANCHOR, ATOM_ERROR } atom_t;
+
+static bool alternation(compiler_t* c);
+
+// ---- charsets ------------------------------------------------------------
+
+static void class_clear(class_t* k, bool negated) {
+    memset(k->bits, 0, sizeof k->bits);
+    k->negated = negated;
+}
+
+static void class_add(class_t* k, unsigned char lo, unsigned char hi) {
+    for (unsigned int ch = lo; ch <= hi; ch++) k->bits[ch >> 3] |= (uint8_t)(1u << (ch & 7));
+}
+
+static void class_add_all(class_t* k, const char* members) {
+    while (*members) { class_add(k, (unsigned char)*members, (unsigned char)*members); members++; }
+}
+
+// Members in ascending order (NUL excluded), returns the count
+static size_t class_members(const class_t* k, char* out) {
+    size_t n = 0;
+    for (unsigned int ch = 1; ch < 256; ch++)
+        if (k->bits[ch >> 3] & (1u << (ch & 7))) out[n++] = (char)ch;
+    out[n] = '\0';
+    return n;
+}
+
+// ---- code buffer ---------------------------------------------------------
+
+static bool is_jump(uint8_t op) {
+    return op == SNO_OP_CHOICE || op == SNO_OP_COMMIT || op == SNO_OP_LOOP || op == SNO_OP_JMP;
+}
+
+static bool emit(compiler_t* c, sno_opcode_t op, uint16_t arg) {
+    return sno_pattern_emit(c->p, op, arg) >= 0;
+}
+
+static bool emit_string(compiler_t* c, sno_opcode_t op, const char* s, size_t n) {
+    int at = sno_pattern_string(c->p, s, n);
+    return at >= 0 && emit(c, op, (uint16_t)at);
+}
+
+// Open a slot at 'at' for a new instruction, relocating jumps across it
+static bool insert(compiler_t* c, uint16_t at, sno_opcode_t op, uint16_t arg) {
+    sno_pattern_t* p = c->p;
+    if (p->count >= SNO_PATTERN_PROG) return false;
+
+    memmove(&p->prog[at + 1], &p->prog[at], (p->count - at) * sizeof(sno_inst_t));
+    p->count++;
+    for (uint16_t i = 0; i < p->count; i++) {
+        sno_inst_t* x = &p->prog[i];
+        if (i == at || !is_jump(x->op)) continue;
+        if (i > at ? x->arg >= at : x->arg > at) x->arg++;  // the block start moved, outside refs to it did not
+    }
+    p->prog[at].op = (uint8_t)op;
+    p->prog[at].reserved = 0;
+    p->prog[at].arg = arg;
+    return true;
+}
+
+// Append a copy of [from, count) with its internal jumps relocated
+static bool duplicate(compiler_t* c, uint16_t from) {
+    sno_pattern_t* p = c->p;
+    uint16_t end = p->count, n = (uint16_t)(end - from);
+    if (n > SNO_PATTERN_PROG - end) return false;
+
+    for (uint16_t i = from; i < end; i++) {
+        sno_inst_t x = p->prog[i];
+        if (is_jump(x.op) && x.arg >= from && x.arg <= end) x.arg = (uint16_t)(x.arg + n);
+        p->prog[p->count++] = x;
+    }
+    return true;
+}
+
+// ---- atoms ---------------------------------------------------------------
+
+static bool class_escape(class_t* k, char e) {
+    switch (e) {
+    case 'd': class_add_all(k, SNO_DIGITS); return true;
+    case 'w': class_add_all(k, WORD); return true;
+    case 's': class_add_all(k, SPACE); return true;
+    default:  return false;
+    }
+}
+
+// \n \t ... and escaped punctuation, -1 if not a single character escape
+static int char_escape(char e) {
+    switch (e) {
+    case 'n': return '\n';
+    case 't': return '\t';
+    case 'r': return '\r';
+    case 'f': return '\f';
+    case 'v': return '\v';
+    default:
+        if ((e >= 'a' && e <= 'z') || (e >= 'A' && e <= 'Z') || (e >= '0' && e <= '9') || e == '\0')
+            return -1;
+        return (unsigned char)e;
+    }
+}
+
+// '[' already consumed
+static bool bracket(compiler_t* c, class_t* k) {
+    class_clear(k, *c->re == '^');
+    if (k->negated) c->re++;
+
+    bool first = true;
+    while (*c->re != ']' || first) {
+        int lo = (unsigned char)*c->re++;
+        first = false;
+        if (lo == '\0') { c->re--; return false; }     // unterminated
+        if (lo == '\\') {
+            if (class_escape(k, *c->re)) { c->re++; continue; }
+            if ((lo = char_escape(*c->re)) < 0) return false;
+            c->re++;
+        }
+
+        int hi = lo;
+        if (c->re[0] == '-' && c->re[1] != ']' && c->re[1] != '\0') {
+            c->re++;
+            hi = (unsigned char)*c->re++;
+            if (hi == '\\' && (hi = char_escape(*c->re++)) < 0) { c->re--; return false; }
+            if (hi < lo) return false;
+        }
+        class_add(k, (unsigned char)lo, (unsigned char)hi);
+    }
+    c->re++;
+    return true;
+}
+
+static atom_t atom(compiler_t* c, class_t* k) {
+    char ch = *c->re;
+    switch (ch) {
+    case '\0': case '|': case ')':
+        return ATOM_NONE;
+    case '*': case '+': case '?': case '{':
+        return ATOM_ERROR;      // nothing to repeat / unsupported interval
+    case '^':
+        c->re++;
+        return emit(c, SNO_OP_BOL, 0) ? ATOM_ANCHOR : ATOM_ERROR;
+    case '$':
+        c->re++;
+        return emit(c, SNO_OP_EOL, 0) ? ATOM_ANCHOR : ATOM_ERROR;
+    case '.':
+        c->re++;
+        class_clear(k, true);
+        class_add(k, '\n', '\n');
+        return ATOM_CLASS;
+    case '[':
+        c->re++;
+        return bracket(c, k) ? ATOM_CLASS : ATOM_ERROR;
+    case '(':
+        if (c->depth >= SNO_REGEX_DEPTH) return ATOM_ERROR;
+        c->re++;
+        c->depth++;
+        if (!alternation(c) || *c->re != ')') return ATOM_ERROR;
+        c->re++;
+        c->depth--;
+        return ATOM_CODE;
+    case '\\': {
+        char e = c->re[1];
+        class_clear(k, e >= 'A' && e <= 'Z');
+        if (class_escape(k, (char)(k->negated ? e - 'A' + 'a' : e))) { c->re += 2; return ATOM_CLASS; }
+        int lit = char_escape(e);
+        if (lit < 0) { c->re++; return ATOM_ERROR; }
+        class_clear(k, false);
+        class_add(k, (unsigned char)lit, (unsigned char)lit);
+        c->re += 2;
+        return ATOM_CLASS;
+    }
+    default:
+        c->re++;
+        class_clear(k, false);
+        class_add(k, (unsigned char)ch, (unsigned char)ch);
+        return ATOM_CLASS;
+    }
+}
+
+// One charset atom with its quantifier (0 for none)
+static bool emit_class(compiler_t* c, const class_t* k, char quant) {
+    char members[256];
+    size_t n = class_members(k, members);
+    uint16_t start = c->p->count;
+
+    if (quant == '?') {
+        if (!emit(c, SNO_OP_CHOICE, 0)) return false;
+        if (!emit_class(c, k, 0) || !emit(c, SNO_OP_COMMIT, 0)) return false;
+        c->p->prog[start].arg = c->p->prog[c->p->count - 1].arg = c->p->count;
+        return true;
+    }
+    if (k->negated) {
+        if (quant == '*') return emit_string(c, SNO_OP_BRK, members, n);
+        if (!emit_string(c, SNO_OP_NOTANY, members, n)) return false;
+        return quant != '+' || emit_string(c, SNO_OP_BRK, members, n);
+    }
+    if (n == 0) return false;
+    if (quant == '*') return emit_string(c, SNO_OP_SKIP, members, n);
+    if (quant == '+') return emit_string(c, SNO_OP_SPAN, members, n);
+    if (n == 1) return emit(c, SNO_OP_CHR, (uint8_t)members[0]);
+    return emit_string(c, SNO_OP_ANY, members, n);
+}
+
+// Quantify the group code at [start, count)
+static bool emit_repeat(compiler_t* c, uint16_t start, char quant) {
+    sno_pattern_t* p = c->p;
+    switch (quant) {
+    case '?':   // choice L; e; commit L; L:
+        if (!insert(c, start, SNO_OP_CHOICE, 0) || !emit(c, SNO_OP_COMMIT, 0)) return false;
+        p->prog[start].arg = p->prog[p->count - 1].arg = p->count;
+        return true;
+    case '+': { // e e*
+        uint16_t again = p->count;
+        return duplicate(c, start) && emit_repeat(c, again, '*');
+    }
+    case '*':   // L0: choice L1; e; loop L0; L1:
+        if (!insert(c, start, SNO_OP_CHOICE, 0) || !emit(c, SNO_OP_LOOP, start)) return false;
+        p->prog[start].arg = p->count;
+        return true;
+    default:
+        return true;
+    }
+}
+
+// ---- grammar -------------------------------------------------------------
+
+static bool sequence(compiler_t* c) {
+    for (;;) {
+        class_t k;
+        uint16_t start = c->p->count;
+        atom_t a = atom(c, &k);
+        if (a == ATOM_NONE) return true;
+        if (a == ATOM_ERROR) return false;
+
+        char quant = 0;
+        if (*c->re == '*' || *c->re == '+' || *c->re == '?') quant = *c->re++;
+        if (*c->re == '*' || *c->re == '+' || *c->re == '?') return false;     // a** a+? ...
+
+        if (a == ATOM_CLASS) {
+            if (!emit_class(c, &k, quant)) return false;
+        } else if (quant) {
+            if (a == ATOM_ANCHOR) { c->re--; return false; }
+            if (!emit_repeat(c, start, quant)) return false;
+        }
+    }
+}
+
+static bool alternation(compiler_t* c) {
+    uint16_t start = c->p->count;
+    uint16_t commits[SNO_PATTERN_PROG / 2];
+    unsigned int n = 0;
+
+    if (!sequence(c)) return false;
+    while (*c->re == '|') {
+        c->re++;
+        // choice L; seq; commit END; L: next seq
+        if (n == sizeof commits / sizeof commits[0] ||
+            !insert(c, start, SNO_OP_CHOICE, 0) || !emit(c, SNO_OP_COMMIT, 0)) return false;
+        commits[n++] = (uint16_t)(c->p->count - 1);
+        start = c->p->prog[start].arg = c->p->count;
+        if (!sequence(c)) return false;
+    }
+    for (unsigned int i = 0; i < n; i++) c->p->prog[commits[i]].arg = c->p->count;
+    return true;
+}
+
+bool sno_regex(sno_pattern_t* p, const char* re, const char** error) {
+    compiler_t c;
+    c.p = p;
+    c.re = re;
+    c.depth = 0;
+
+    bool ok = p && re;
+    if (ok) {
+        sno_pattern_init(p);
+        ok = alternation(&c) && *c.re == '\0' && emit(&c, SNO_OP_MATCH, 0);
+    }
+    if (error) *error = ok ? NULL : c.re;
+    if (!ok && p) sno_pattern_init(p);
+    return ok;
+}
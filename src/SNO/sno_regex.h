@@ -0,0 +1,36 @@
+/**
+ * @file sno_regex.h
+ * @brief SNOBOL4-C Library — Regular Expression Subset Front End
+ *
+ * Compiles a familiar regex subset into a pattern object (sno_pattern.h)
+ * whose instructions are the core primitives, so it runs with the same
+ * anchored cursor and Failure Contract as hand written patterns.
+ *
+ * Supported:
+ *   literals, '.', [set] [^set] with ranges, \d \w \s \D \W \S,
+ *   \n \t \r \f \v, \ + punctuation, ( ), |, * + ?, ^ and $ (line anchors)
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Semantics differ from POSIX regexec where SNOBOL does:
+ *  + Repetition is possessive: "[a-z]*z" never matches, "[a-y]*z" does
+ *  + Alternation is ordered: "a|ab" against "ab" matches "a"
+ *  + Not supported (compile error): {m,n}, backreferences, lazy quantifiers
+ */
+#ifndef SNO_REGEX_H
+#define SNO_REGEX_H
+
+#include "sno_pattern.h"
+
+#define SNO_REGEX_DEPTH 16  // nested groups
+
+/**
+ * @brief Compile a regular expression into a pattern
+ * @param error  optional: receives the position in re where compilation stopped, NULL on success
+ * @return true if compiled, false on a syntax error or a pattern too big for sno_pattern_t
+ */
+bool sno_regex(sno_pattern_t* p, const char* re, const char** error);
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * @file sno_scan.c
+ * @brief SNOBOL4-C Library — Lazy All-Matches Enumeration Implementation
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include "sno_scan.h"
+#include "sno_core.h"
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_string.h"
+#else
+    #include <string.h>
+#endif
+
+bool sno_scan_init(sno_scan_t* it, const sno_pattern_t* p, view_t subject, bool overlap) {
+    if (!it || !p || !subject.begin || !subject.end || subject.begin > subject.end) return false;
+
+    it->p = p;
+    it->next = it->origin = subject.begin;
+    it->end = subject.end;
+    it->overlap = overlap;
+    it->done = false;
+    it->lead = '\0';
+    it->filter = SNO_SCAN_ALL;
+
+    if (sno_pattern_first(p, 0, p->count, it->first)) {
+        unsigned int members = 0;
+        for (unsigned int c = 0; c < 256; c++)
+            if (it->first[c >> 3] & (1u << (c & 7))) { members++; it->lead = (char)c; }
+        it->filter = members == 1 ? SNO_SCAN_BYTE : SNO_SCAN_SET;
+    }
+    return true;
+}
+
+// First candidate start at or after 'at', or end
+static cursor_t candidate(const sno_scan_t* it, cursor_t at) {
+    if (it->filter == SNO_SCAN_BYTE) {
+#ifdef POLICY_USE_DOSLIBC
+        while (at < it->end && *at != it->lead) at++;
+#else
+        at = memchr(at, it->lead, (size_t)(it->end - at));
+        if (!at) at = it->end;
+#endif
+    } else {
+        while (at < it->end && !(it->first[(unsigned char)*at >> 3] & (1u << ((unsigned char)*at & 7)))) at++;
+    }
+    return at;
+}
+
+bool sno_scan_next(sno_scan_t* it, view_t* match) {
+    if (!it || !match) return false;
+
+    while (!it->done) {
+        cursor_t at = it->next;
+        if (it->filter != SNO_SCAN_ALL) {
+            at = candidate(it, at);
+            if (at == it->end) break;       // a match needs at least one byte
+        }
+
+        view_t s = view(at, it->end);
+        bool hit = sno_exec(it->p, &s, it->origin);
+        if (at == it->end) it->done = true;
+        else it->next = (hit && !it->overlap && s.begin > at) ? s.begin : at + 1;
+
+        if (hit) {
+            *match = view(at, s.begin);
+            return true;
+        }
+    }
+    it->done = true;
+    return false;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file sno_scan.h
+ * @brief SNOBOL4-C Library — Lazy All-Matches Enumeration
+ *
+ * A generator over a subject: every sno_scan_next() call resumes where the
+ * last one stopped and yields the next match span of a compiled pattern,
+ * so callers that only want the first few hits stop paying when they stop
+ * asking.
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Design Decisions:
+ *  + Prefilter - the set of bytes that can start a match is computed once
+ *    from the program; candidate positions are found by a byte scan instead
+ *    of running the pattern at every position
+ *  + Non-overlapping by default - the next attempt starts at the end of the
+ *    previous match (one byte later after an empty match)
+ *  + Yielded spans are views into the subject: no copies
+ */
+#ifndef SNO_SCAN_H
+#define SNO_SCAN_H
+
+#include "sno_pattern.h"
+
+/**
+ * Prefilter kinds
+ */
+typedef enum {
+    SNO_SCAN_ALL,       // pattern may match empty / start with anything: try every position
+    SNO_SCAN_BYTE,      // every match starts with the same byte
+    SNO_SCAN_SET        // every match starts with a byte of first[]
+} sno_scan_filter_t;
+
+/**
+ * Generator state
+ */
+typedef struct {
+    const sno_pattern_t* p;
+    cursor_t next;          // next start position to try
+    cursor_t end;           // end of subject
+    cursor_t origin;        // start of subject, for '^'
+    bool     overlap;       // resume one byte after each match start
+    bool     done;
+    uint8_t  filter;        // sno_scan_filter_t
+    char     lead;          // SNO_SCAN_BYTE
+    uint8_t  first[32];     // SNO_SCAN_SET
+} sno_scan_t;
+
+/**
+ * @brief Prepare to enumerate matches of p in subject
+ * @param overlap  false: non-overlapping matches, true: a match may start inside the previous one
+ * @return true if ready, false on NULL args
+ * @note the pattern and the subject text must outlive the generator
+ */
+bool sno_scan_init(sno_scan_t* it, const sno_pattern_t* p, view_t subject, bool overlap);
+
+/**
+ * @brief Yield the next match
+ * SUCCESS: match holds the span, the generator moves past it
+ * FAILURE: no more matches (every later call fails too)
+ * @return true if a match was found
+ */
+bool sno_scan_next(sno_scan_t* it, view_t* match);
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * @file sno_store.c
+ * @brief SNOBOL4-C Library — Serialized Compiled Patterns Implementation
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include "sno_store.h"
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stdio.h"
+    #include "dos_string.h"
+#else
+    #include <stdio.h>
+    #include <string.h>
+#endif
+
+static void header(sno_store_header_t* h, uint16_t count) {
+    memcpy(h->magic, SNO_STORE_MAGIC, 4);
+    h->version = SNO_STORE_VERSION;
+    h->count = count;
+    h->prog = SNO_PATTERN_PROG;
+    h->pool = SNO_PATTERN_POOL;
+}
+
+size_t sno_store_size(uint16_t count) {
+    size_t room = (size_t)-1 - sizeof(sno_store_header_t);
+    if (count > room / sizeof(sno_pattern_t)) return 0;
+    return sizeof(sno_store_header_t) + (size_t)count * sizeof(sno_pattern_t);
+}
+
+bool sno_store_save(const char* path, const sno_pattern_t* patterns, uint16_t count) {
+    if (!path || (!patterns && count) || sno_store_size(count) == 0) return false;
+
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+
+    sno_store_header_t h;
+    header(&h, count);
+    bool ok = fwrite(&h, sizeof h, 1, f) == 1 &&
+              (count == 0 || fwrite(patterns, sizeof(sno_pattern_t), count, f) == count);
+    return fclose(f) == 0 && ok;
+}
+
+const sno_pattern_t* sno_store_load(const char* path, void* buf, size_t size, uint16_t* count) {
+    if (!path || !buf) return NULL;
+
+    FILE* f = fopen(path, "rb");
+    if (!f) return NULL;
+    size_t n = fread(buf, 1, size, f);      // the one read: header and patterns together
+    fclose(f);
+    return sno_store_map(buf, n, count);
+}
+
+const sno_pattern_t* sno_store_map(const void* image, size_t size, uint16_t* count) {
+    if (!image || !count || size < sizeof(sno_store_header_t)) return NULL;
+
+    sno_store_header_t h, want;
+    memcpy(&h, image, sizeof h);
+    header(&want, h.count);
+    if (memcmp(&h, &want, sizeof h) != 0 || sno_store_size(h.count) != size) return NULL;
+
+    const sno_pattern_t* patterns = (const sno_pattern_t*)((const char*)image + sizeof h);
+    for (uint16_t i = 0; i < h.count; i++)
+        if (!sno_pattern_check(&patterns[i])) return NULL;
+
+    *count = h.count;
+    return patterns;
+}
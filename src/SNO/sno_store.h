@@ -0,0 +1,68 @@
+/**
+ * @file sno_store.h
+ * @brief SNOBOL4-C Library — Serialized Compiled Patterns
+ *
+ * Compile once, save, and at the next launch load every pattern with one
+ * read instead of recompiling. Because sno_pattern_t holds no pointers the
+ * file image is used in place: after sno_store_map() the patterns point
+ * straight into the loaded buffer (or into an mmap()ed file on the host).
+ *
+ * File layout (little endian, identical for the DOS and x86 host builds):
+ *   sno_store_header_t   magic "SNOP", version, pattern count, PROG, POOL
+ *   sno_pattern_t[count] raw pattern objects
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Host mmap use:
+ *   void* base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+ *   const sno_pattern_t* set = sno_store_map(base, size, &count);
+ */
+#ifndef SNO_STORE_H
+#define SNO_STORE_H
+
+#include "sno_pattern.h"
+
+#define SNO_STORE_MAGIC     "SNOP"
+#define SNO_STORE_VERSION   1
+
+/**
+ * File header - PROG and POOL must match the loader's build
+ */
+typedef struct {
+    char     magic[4];
+    uint16_t version;
+    uint16_t count;     // patterns that follow
+    uint16_t prog;      // SNO_PATTERN_PROG of the writer
+    uint16_t pool;      // SNO_PATTERN_POOL of the writer
+} sno_store_header_t;
+
+/**
+ * @brief Bytes needed for an image of count patterns
+ * @return image size, 0 if it does not fit in size_t (16 bit on DOS: 42 patterns max)
+ */
+size_t sno_store_size(uint16_t count);
+
+/**
+ * @brief Write count patterns to a file
+ * @return true if the whole image was written
+ */
+bool sno_store_save(const char* path, const sno_pattern_t* patterns, uint16_t count);
+
+/**
+ * @brief Read a pattern file into buf with a single read and map it
+ * @param count  receives the number of patterns
+ * @return the patterns inside buf, NULL if unreadable, too big for buf or invalid
+ */
+const sno_pattern_t* sno_store_load(const char* path, void* buf, size_t size, uint16_t* count);
+
+/**
+ * @brief Validate an image in memory and return its patterns in place (zero-copy)
+ * @param count  receives the number of patterns
+ * @return the patterns inside image, NULL if the header or any pattern is invalid
+ * @note image must be at least 2 byte aligned (any malloc/mmap result is)
+ */
+const sno_pattern_t* sno_store_map(const void* image, size_t size, uint16_t* count);
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file sno_tree.c
+ * @brief SNOBOL4-C Library — Zero-Copy Parse Tree Builder Implementation
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include "sno_tree.h"
+#include "sno_core.h"
+
+// Link a fresh node under the innermost open node
+static uint16_t append(sno_tree_t* t, uint16_t kind, view_t span) {
+    if (!t || !t->nodes || t->depth == 0 || t->count >= t->capacity) return SNO_TREE_NIL;
+
+    uint16_t i = t->count++;
+    sno_node_t* n = &t->nodes[i];
+    n->span = span;
+    n->kind = kind;
+    n->child = n->sibling = SNO_TREE_NIL;
+
+    sno_open_t* top = &t->open[t->depth - 1];
+    if (top->last == SNO_TREE_NIL) t->nodes[top->node].child = i;
+    else t->nodes[top->last].sibling = i;
+    top->last = i;
+    return i;
+}
+
+bool sno_tree_init(sno_tree_t* t, sno_node_t* nodes, uint16_t capacity, uint16_t kind, view_t subject) {
+    if (!t || !nodes || capacity == 0 || capacity == SNO_TREE_NIL) return false;
+
+    t->nodes = nodes;
+    t->capacity = capacity;
+    t->count = 1;
+    t->depth = 1;
+    t->open[0].node = 0;
+    t->open[0].last = SNO_TREE_NIL;
+
+    nodes[0].span = subject;
+    nodes[0].kind = kind;
+    nodes[0].child = nodes[0].sibling = SNO_TREE_NIL;
+    return true;
+}
+
+uint16_t sno_tree_open(sno_tree_t* t, uint16_t kind, cursor_t begin) {
+    if (!t || t->depth >= SNO_TREE_DEPTH) return SNO_TREE_NIL;
+
+    uint16_t i = append(t, kind, view(begin, begin));
+    if (i == SNO_TREE_NIL) return SNO_TREE_NIL;
+
+    t->open[t->depth].node = i;
+    t->open[t->depth].last = SNO_TREE_NIL;
+    t->depth++;
+    return i;
+}
+
+bool sno_tree_close(sno_tree_t* t, cursor_t end) {
+    if (!t || t->depth == 0) return false;
+    t->nodes[t->open[--t->depth].node].span.end = end;
+    return true;
+}
+
+uint16_t sno_tree_leaf(sno_tree_t* t, uint16_t kind, view_t span) {
+    return append(t, kind, span);
+}
+
+bool cap(sno_tree_t* t, uint16_t kind, cursor_t begin, const view_t* subject) {
+    if (!subject) return false;
+    return append(t, kind, view(begin, subject->begin)) != SNO_TREE_NIL;
+}
+
+sno_mark_t sno_tree_mark(const sno_tree_t* t, const view_t* subject) {
+    sno_mark_t m;
+    m.count = t ? t->count : 0;
+    m.depth = t ? t->depth : 0;
+    m.last = (t && t->depth) ? t->open[t->depth - 1].last : SNO_TREE_NIL;
+    m.cursor = subject ? subject->begin : NULL;
+    return m;
+}
+
+bool sno_tree_rollback(sno_tree_t* t, sno_mark_t mark, view_t* subject) {
+    if (subject && mark.cursor) subject->begin = mark.cursor;   // Failure Contract
+    if (!t || mark.count > t->count) return false;
+
+    t->count = mark.count;          // nodes past the mark are simply forgotten
+    t->depth = mark.depth;
+    if (t->depth) {                 // unlink the first discarded child, if any
+        sno_open_t* top = &t->open[t->depth - 1];
+        top->last = mark.last;
+        if (mark.last == SNO_TREE_NIL) t->nodes[top->node].child = SNO_TREE_NIL;
+        else t->nodes[mark.last].sibling = SNO_TREE_NIL;
+    }
+    return false;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file sno_tree.h
+ * @brief SNOBOL4-C Library — Zero-Copy Parse Tree Builder
+ *
+ * Records the structure recognized by recursive-descent grammars written
+ * with the SNO primitives. Nodes are (kind, view_t span, first child,
+ * next sibling) held in one caller supplied array and linked by index.
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Design Decisions:
+ *  + Zero-copy - spans point into the subject, nothing is allocated
+ *  + Nodes are appended in document order, so array order IS pre-order
+ *  + Mark/rollback mirrors the Failure Contract - an abandoned alternative
+ *    discards its nodes (and optionally restores the cursor) in O(1)
+ *  + Index links (uint16_t) instead of pointers - half the size on DOS
+ *
+ * @note Grammar rule idiom:
+ *      sno_mark_t m = sno_tree_mark(t, s);
+ *      return (sno_tree_open(t, SUM, s->begin) != SNO_TREE_NIL &&
+ *              term(s, t) && chr(s, '+') && term(s, t) &&
+ *              sno_tree_close(t, s->begin)) || sno_tree_rollback(t, m, s);
+ */
+#ifndef SNO_TREE_H
+#define SNO_TREE_H
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stddef.h"
+    #include "dos_stdbool.h"
+    #include "dos_stdint.h"
+#else
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdint.h>
+#endif
+
+#include "sno_types.h"
+
+#define SNO_TREE_NIL    0xFFFFu     // no child / no sibling / no node
+#define SNO_TREE_DEPTH  32          // maximum nesting of open nodes
+
+/**
+ * Parse tree node - 14 bytes on DOS (far pointers), 24 on a 64-bit host
+ */
+typedef struct {
+    view_t   span;      // matched text [begin, end)
+    uint16_t kind;      // caller defined node kind
+    uint16_t child;     // first child or SNO_TREE_NIL
+    uint16_t sibling;   // next sibling or SNO_TREE_NIL
+} sno_node_t;
+
+/**
+ * Open node and its last child (O(1) append)
+ */
+typedef struct {
+    uint16_t node;
+    uint16_t last;
+} sno_open_t;
+
+/**
+ * Tree under construction - root is node 0
+ */
+typedef struct {
+    sno_node_t* nodes;                  // caller storage
+    uint16_t    capacity;
+    uint16_t    count;
+    uint16_t    depth;                  // open nodes on stack
+    sno_open_t  open[SNO_TREE_DEPTH];
+} sno_tree_t;
+
+/**
+ * Rollback point - node count, nesting and cursor at the time of the mark
+ */
+typedef struct {
+    uint16_t count;
+    uint16_t depth;
+    uint16_t last;      // last child of the innermost open node
+    cursor_t cursor;    // subject->begin, NULL if no subject was given
+} sno_mark_t;
+
+/**
+ * @brief Start a tree whose open root node spans the subject
+ * @param t         tree to initialize
+ * @param nodes     caller storage for capacity nodes
+ * @param capacity  number of nodes (>= 1, < SNO_TREE_NIL)
+ * @param kind      kind of root node
+ * @param subject   text being parsed (root span)
+ * @return true on success, false on NULL or zero capacity
+ */
+bool sno_tree_init(sno_tree_t* t, sno_node_t* nodes, uint16_t capacity, uint16_t kind, view_t subject);
+
+/**
+ * @brief Append a child to the innermost open node and open it
+ * @return index of new node, SNO_TREE_NIL if out of nodes or nesting too deep
+ * @note span.end is set to begin until sno_tree_close()
+ */
+uint16_t sno_tree_open(sno_tree_t* t, uint16_t kind, cursor_t begin);
+
+/**
+ * @brief Close the innermost open node, setting its span end
+ * @return true, or false if no node is open (composes in && chains)
+ */
+bool sno_tree_close(sno_tree_t* t, cursor_t end);
+
+/**
+ * @brief Append a complete (childless) node to the innermost open node
+ * @return index of new node, SNO_TREE_NIL if out of nodes or nothing open
+ */
+uint16_t sno_tree_leaf(sno_tree_t* t, uint16_t kind, view_t span);
+
+/**
+ * @brief Capture [begin, subject->begin) as a leaf (SNOBOL . assignment)
+ * @return true if recorded - use after the primitives that matched the span
+ * @note e.g. (p = s.begin, span(&s, SNO_DIGITS)) && cap(&t, NUM, p, &s)
+ */
+bool cap(sno_tree_t* t, uint16_t kind, cursor_t begin, const view_t* subject);
+
+/**
+ * @brief Take a rollback point
+ * @param subject  parsing context whose cursor is saved, or NULL
+ */
+sno_mark_t sno_tree_mark(const sno_tree_t* t, const view_t* subject);
+
+/**
+ * @brief Discard every node created since the mark and restore the cursor - O(1)
+ * @param subject  parsing context to rewind to the marked cursor, or NULL
+ * @return false always, so a failing rule can end with || sno_tree_rollback(...)
+ * @note The mark must be rolled back before any node open at mark time is closed
+ */
+bool sno_tree_rollback(sno_tree_t* t, sno_mark_t mark, view_t* subject);
+
+#endif
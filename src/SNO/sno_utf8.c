@@ -0,0 +1,172 @@
+/**
+ * @file sno_utf8.c
+ * @brief SNOBOL4-C Library — UTF-8 Code Point Primitives Implementation
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#define SNO_PROFILE_IMPL    // definitions below must not be redirected
+#include "sno_utf8.h"
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_string.h"
+#else
+    #include <string.h>
+
+    // SWAR: one 64-bit load tests 8 bytes for the high bit
+    typedef uint64_t word_t;
+    #define HIGH_BITS   0x8080808080808080ULL
+    #define WORD        ((ptrdiff_t)sizeof(word_t))
+
+    static bool ascii_word(cursor_t p) {
+        word_t w;
+        memcpy(&w, p, sizeof w);    // unaligned safe, compiles to a single load
+        return (w & HIGH_BITS) == 0;
+    }
+#endif
+
+static unsigned int decode(cursor_t p, cursor_t end, uint32_t* cp) {
+    if (p >= end) return 0;
+
+    unsigned char b = (unsigned char)*p;
+    if (b < 0x80) {
+        *cp = b;
+        return 1;
+    }
+
+    unsigned int n;
+    uint32_t c, min;
+    if (b >= 0xC2 && b <= 0xDF)      { n = 2; c = b & 0x1Fu; min = 0x80; }
+    else if ((b & 0xF0) == 0xE0)     { n = 3; c = b & 0x0Fu; min = 0x800; }
+    else if (b >= 0xF0 && b <= 0xF4) { n = 4; c = b & 0x07u; min = 0x10000UL; }
+    else return 0;                  // continuation byte, C0/C1 overlong lead, F5-FF
+
+    if (end - p < (ptrdiff_t)n) return 0;
+    for (unsigned int i = 1; i < n; i++) {
+        b = (unsigned char)p[i];
+        if ((b & 0xC0) != 0x80) return 0;
+        c = (c << 6) | (b & 0x3Fu);
+    }
+    if (c < min || c > SNO_UTF8_MAX || (c >= 0xD800 && c <= 0xDFFF)) return 0;
+    *cp = c;
+    return n;
+}
+
+static bool ascii_member(const sno_uset_t* set, unsigned char c) {
+    return (set->ascii[c >> 3] >> (c & 7)) & 1u;
+}
+
+static bool member(const sno_uset_t* set, uint32_t cp) {
+    if (cp < 0x80) return ascii_member(set, (unsigned char)cp);
+    for (unsigned int i = 0; i < set->count; i++)
+        if (cp >= set->ranges[i].lo && cp <= set->ranges[i].hi) return true;
+    return false;
+}
+
+bool sno_uset_init(sno_uset_t* set, const sno_urange_t* ranges, unsigned int count) {
+    if (!set || (!ranges && count)) return false;
+    memset(set->ascii, 0, sizeof set->ascii);
+    set->count = 0;
+
+    for (unsigned int i = 0; i < count; i++) {
+        uint32_t lo = ranges[i].lo, hi = ranges[i].hi;
+        if (lo > hi || hi > SNO_UTF8_MAX) return false;
+
+        for (uint32_t c = lo; c <= hi && c < 0x80; c++) set->ascii[c >> 3] |= (uint8_t)(1u << (c & 7));
+        if (hi >= 0x80) {
+            if (set->count == SNO_USET_RANGES) return false;
+            set->ranges[set->count].lo = lo < 0x80 ? 0x80 : lo;
+            set->ranges[set->count++].hi = hi;
+        }
+    }
+    return true;
+}
+
+unsigned int sno_utf8_decode(view_t subject, uint32_t* cp) {
+    uint32_t c;
+    if (!subject.begin || !subject.end) return 0;
+    unsigned int n = decode(subject.begin, subject.end, &c);
+    if (n && cp) *cp = c;
+    return n;
+}
+
+unsigned long usize(view_t view) {
+    if (!view.begin || !view.end) return 0;
+
+    unsigned long n = 0;
+    cursor_t p = view.begin;
+    while (p < view.end) {
+#ifndef POLICY_USE_DOSLIBC
+        if (view.end - p >= WORD && ascii_word(p)) {
+            p += WORD;
+            n += WORD;
+            continue;
+        }
+#endif
+        uint32_t cp;
+        unsigned int k = decode(p, view.end, &cp);
+        if (!k) return 0;
+        p += k;
+        n++;
+    }
+    return n;
+}
+
+bool ulen(view_t* subject, unsigned int count) {
+    if (!subject || !subject->begin || !subject->end) return false;
+
+    cursor_t p = subject->begin;
+    while (count) {
+#ifndef POLICY_USE_DOSLIBC
+        if (count >= (unsigned int)WORD && subject->end - p >= WORD && ascii_word(p)) {
+            p += WORD;
+            count -= (unsigned int)WORD;
+            continue;
+        }
+#endif
+        uint32_t cp;
+        unsigned int n = decode(p, subject->end, &cp);
+        if (!n) return false;   // cursor unchanged
+        p += n;
+        count--;
+    }
+    subject->begin = p;
+    return true;
+}
+
+bool uany(view_t* subject, const sno_uset_t* set) {
+    if (!subject || !subject->begin || !subject->end || !set) return false;
+
+    uint32_t cp;
+    unsigned int n = decode(subject->begin, subject->end, &cp);
+    if (!n || !member(set, cp)) return false;
+    subject->begin += n;
+    return true;
+}
+
+bool uspan(view_t* subject, const sno_uset_t* set) {
+    if (!subject || !subject->begin || !subject->end || !set) return false;
+
+    cursor_t p = subject->begin;
+    for (;;) {
+#ifndef POLICY_USE_DOSLIBC
+        // A pure ASCII word is tested straight from the bitmap, no decoding
+        if (subject->end - p >= WORD && ascii_word(p)) {
+            ptrdiff_t i = 0;
+            while (i < WORD && ascii_member(set, (unsigned char)p[i])) i++;
+            p += i;
+            if (i < WORD) break;
+            continue;
+        }
+#endif
+        uint32_t cp;
+        unsigned int n = decode(p, subject->end, &cp);
+        if (!n || !member(set, cp)) break;
+        p += n;
+    }
+
+    if (p == subject->begin) return false;
+    subject->begin = p;
+    return true;
+}
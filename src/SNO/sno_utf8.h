@@ -0,0 +1,112 @@
+/**
+ * @file sno_utf8.h
+ * @brief SNOBOL4-C Library — UTF-8 Code Point Primitives
+ *
+ * view_t stays byte oriented; these primitives step over whole UTF-8
+ * encoded code points instead of bytes, so len()/any()/span() style
+ * matching never splits a multi-byte character.
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file or https://opensource.org/licenses/MIT
+ *
+ * @note Design Decisions:
+ *  + Strict decoding - overlong forms, surrogates, values past U+10FFFF and
+ *    truncated sequences are not code points: the primitive fails on them
+ *  + ASCII fast path - text is mostly ASCII, so whole machine words are
+ *    tested for the high bit at once (SWAR) and ASCII runs skip decoding;
+ *    the DOS build steps byte by byte (no wide registers to gain from)
+ *  + Code point sets are prepared once (sno_uset_init): ASCII members in a
+ *    bitmap, the rest as ranges
+ */
+#ifndef SNO_UTF8_H
+#define SNO_UTF8_H
+
+#ifdef POLICY_USE_DOSLIBC
+    #include "dos_stddef.h"
+    #include "dos_stdbool.h"
+    #include "dos_stdint.h"
+#else
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdint.h>
+#endif
+
+#include "sno_types.h"
+
+#define SNO_USET_RANGES 16      // non-ASCII ranges per set
+#define SNO_UTF8_MAX    0x10FFFFUL
+
+/**
+ * Inclusive code point range
+ */
+typedef struct {
+    uint32_t lo;
+    uint32_t hi;
+} sno_urange_t;
+
+/**
+ * Prepared code point set
+ */
+typedef struct {
+    uint8_t      ascii[16];                 // bit c set if U+00c is a member (c < 0x80)
+    uint8_t      count;                     // ranges used
+    sno_urange_t ranges[SNO_USET_RANGES];   // members >= U+0080
+} sno_uset_t;
+
+/**
+ * @brief Prepare a set from code point ranges
+ * @return true if built, false on NULL args, lo > hi, or more than SNO_USET_RANGES non-ASCII ranges
+ */
+bool sno_uset_init(sno_uset_t* set, const sno_urange_t* ranges, unsigned int count);
+
+/**
+ * @brief Decode the code point at the cursor without moving it
+ * @return encoded length in bytes (1-4), 0 at the end or on invalid UTF-8
+ */
+unsigned int sno_utf8_decode(view_t subject, uint32_t* cp);
+
+/**
+ * @brief Number of code points in a view
+ * @return code point count, or 0 if the view is not valid UTF-8
+ */
+unsigned long usize(view_t view);
+
+/**
+ * SNOBOL LEN(n) over code points
+ * @brief match exactly count code points
+ * SUCCESS: cursor advanced past count code points
+ * FAILURE: cursor unchanged (too few code points or invalid UTF-8 among them)
+ * @return true on success, false on failure or NULL arguments
+ */
+bool ulen(view_t* subject, unsigned int count);
+
+/**
+ * SNOBOL ANY(set) over code points
+ * @brief match one code point from set
+ * SUCCESS: cursor advanced past one code point
+ * FAILURE: cursor unchanged (not a member, end of subject or invalid UTF-8)
+ * @return true if matched, false otherwise or on NULL arguments
+ */
+bool uany(view_t* subject, const sno_uset_t* set);
+
+/**
+ * SNOBOL SPAN(set) over code points
+ * @brief match 1+ consecutive code points from set (greedy, anchored)
+ * SUCCESS: cursor advanced past the longest run of members (stops before invalid UTF-8)
+ * FAILURE: cursor unchanged (first code point not a member)
+ * @return true if >= 1 code point matched, false otherwise or on NULL arguments
+ */
+bool uspan(view_t* subject, const sno_uset_t* set);
+
+/**
+ * SNO_PROFILE: route every primitive call through the profiler (see sno_profile.h)
+ */
+#if defined(SNO_PROFILE) && !defined(SNO_PROFILE_IMPL)
+    #include "sno_profile.h"
+    #define ulen(s, n)      SNO_PROFILED(SNO_PROF_ULEN, (s), ulen((s), (n)))
+    #define uany(s, u)      SNO_PROFILED(SNO_PROF_UANY, (s), uany((s), (u)))
+    #define uspan(s, u)     SNO_PROFILED(SNO_PROF_USPAN, (s), uspan((s), (u)))
+#endif
+
+#endif
@@ -19,6 +19,7 @@ extern int errno;
 #define EXDEV   18      // Cross-device link
 #define EMFILE  24      // Too many open files
 #define EINVAL  22      // Invalid argument
+#define ENOSPC  28      // No space left on device
 
 // mapping function
 int dos_to_errno(dos_error_code_t dos_err);
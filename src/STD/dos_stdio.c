@@ -4,285 +4,830 @@
 #include "dos_stdbool.h"
 #include "dos_limits.h"
 #include "dos_stdarg.h"
+#include "dos_stdlib.h"
+#include "../SNO/sno_core.h"
 #include "../DOS/dos_services_constants.h"
 #include "../DOS/dos_file_constants.h"
 
-// helper functions
-static int print_hex(unsigned long val, bool uppercase, FILE* stream) {
-    int count = 0;
-    if (val > 15) {
-        int n = print_hex(val >> 4, uppercase, stream);
-        if (n == EOF) return EOF;
-        count += n;
+// Streams
+
+static char stdin_buffer[DOS_STDIO_GETS_MAX];
+static char stdout_buffer[BUFSIZ];
+
+FILE dos_streams[FOPEN_MAX] = {
+    {0, DOS_STREAM_OPEN | DOS_STREAM_READ | DOS_STREAM_TEXT, _IOLBF, stdin_buffer, sizeof(stdin_buffer), 0, 0, 0, 0, DOS_STDIO_UNKNOWN, DOS_STDIO_UNKNOWN},
+    {1, DOS_STREAM_OPEN | DOS_STREAM_WRITE | DOS_STREAM_TEXT, _IOLBF, stdout_buffer, sizeof(stdout_buffer), 0, 0, 0, 0, DOS_STDIO_UNKNOWN, DOS_STDIO_UNKNOWN},
+    {2, DOS_STREAM_OPEN | DOS_STREAM_WRITE | DOS_STREAM_TEXT, _IONBF, NULL, 0, 0, 0, 0, 0, DOS_STDIO_UNKNOWN, DOS_STDIO_UNKNOWN}
+};
+
+// Console raw mode
+
+enum { CONSOLE_UNKNOWN, CONSOLE_OTHER, CONSOLE_COOKED, CONSOLE_RAW };
+
+static uint8_t  console = CONSOLE_UNKNOWN;  // stdout's device, looked at on the first bulk write
+static uint16_t console_info;               // its cooked device word, to switch back to
+
+// Switch stdout's device between raw and cooked; files and devices already raw are left alone
+static void console_mode(bool raw) {
+    if (console == CONSOLE_UNKNOWN) {
+        if (!raw) return;
+        console = CONSOLE_OTHER;
+        if (dos_get_device_info(stdout->handle, &console_info) == DOS_SUCCESS &&
+            (console_info & DOS_DEV_CHAR) && !(console_info & DOS_DEV_BINARY)) console = CONSOLE_COOKED;
     }
-    int digit = val & 0xF;
-    char c = digit < 10 ? '0' + digit : (uppercase ? 'A' : 'a') + digit - 10;
-    if (fputc(c, stream) == EOF) return EOF;
-    return count + 1;
+    if (console == CONSOLE_OTHER || raw == (console == CONSOLE_RAW)) return;
+    if (dos_set_device_info(stdout->handle, raw ? console_info | DOS_DEV_BINARY : console_info) == DOS_SUCCESS)
+        console = raw ? CONSOLE_RAW : CONSOLE_COOKED;
 }
 
-static int print_uint(unsigned long val, int base, FILE* stream) {
-    int count = 0;
-    if (val >= base) {
-        int n = print_uint(val / base, base, stream);
-        if (n == EOF) return EOF;
-        count += n;
+static dos_console_write_t console_write;   // set: stdout and stderr bypass DOS
+static void*               console_ctx;
+
+static bool flush_at_exit = false;
+
+static void flush_all(void) {
+    fflush(NULL);
+    console_mode(false);
+}
+
+// Allocate the buffer on first I/O; without one the stream is unbuffered
+static void attach_buffer(FILE* stream) {
+    if (stream->buffer || stream->mode == _IONBF) return;
+    stream->buffer = (char*)dos_malloc(stream->size);
+    if (stream->buffer) {
+        stream->flags |= DOS_STREAM_OWNBUF;
+    } else {
+        stream->mode = _IONBF;
+        stream->size = 0;
     }
-    int digit = val % base;
-    char c = digit < 10 ? '0' + digit : 'A' + digit - 10;
-    if (fputc(c, stream) == EOF) return EOF;
-    return count + 1;
 }
 
-static int print_int(long val, int base, FILE* stream) {
-    int count = 0;
-    if (val < 0) {
-        if (fputc('-', stream) == EOF) return EOF;
-        count++;
-        if (val == LONG_MIN) {
-            if (base == 10) {
-                int n = print_uint((unsigned long)(-(val + 1)), 10, stream);
-                if (n == EOF) return EOF;
-                return count + n;
-            }
-            return count;
+static void release_buffer(FILE* stream) {
+    if (stream->flags & DOS_STREAM_OWNBUF) dos_free(stream->buffer);
+    stream->flags &= ~DOS_STREAM_OWNBUF;
+    stream->buffer = NULL;
+    stream->count = stream->next = stream->newlines = stream->raw = 0;
+}
+
+// The DOS file pointer moved n bytes on with a read or write; a write past the known end makes the file longer
+static void advance(FILE* stream, uint16_t n) {
+    if (stream->pos == DOS_STDIO_UNKNOWN) return;
+    stream->pos += n;
+    if (stream->length != DOS_STDIO_UNKNOWN && stream->pos > stream->length) stream->length = stream->pos;
+}
+
+// Move the DOS file pointer and keep where it went; after a failure the position is not known
+static dos_error_code_t seek_to(FILE* stream, dos_file_position_t offset, uint8_t origin) {
+    dos_file_position_t pos = 0;
+    dos_error_code_t err = dos_move_file_pointer(stream->handle, offset, origin, &pos);
+    stream->pos = (err == DOS_SUCCESS) ? pos : DOS_STDIO_UNKNOWN;
+    return err;
+}
+
+// One DOS write; a short count means the disk is full
+static bool write_out(FILE* stream, const char* s, size_t n) {
+    uint16_t done = 0;
+    if (n == 0) return true;    // a 0 byte DOS write truncates the file
+    if (stream == stdout || stream == stderr) {
+        if (console_write) {
+            console_write(console_ctx, s, (uint16_t)n);
+            return true;
         }
-        val = -val;
+        // Short writes keep the mode they find: switching per line would double the DOS calls
+        bool tab = false;
+        for (size_t i = 0; !tab && i < n; i++) tab = s[i] == '\t';
+        if (stream == stderr || tab) console_mode(false);
+        else if (n >= DOS_STDIO_RAW_MIN) console_mode(true);
+    }
+    dos_error_code_t err = dos_write_file(stream->handle, (uint16_t)n, s, &done);
+    advance(stream, done);
+    if (err != DOS_SUCCESS || done != n) {
+        errno = err ? dos_to_errno(err) : ENOSPC;
+        return false;
     }
-    int n = print_uint(val, base, stream);
-    if (n == EOF) return EOF;
-    return count + n;
+    return true;
 }
 
-#ifdef USE_DOSLIBC_FLOAT_PRINTF
-static int print_float(double val, FILE* stream) {
-    int count = 0;
+// Text output: turn each pending '\n' into "\r\n", back to front into the bytes put() kept free
+static uint16_t expand(FILE* stream) {
+    uint16_t added = stream->newlines;
+    char* src = stream->buffer + stream->count;
+    char* dst = src + added;
+    while (dst > src) {
+        char c = *--src;
+        *--dst = c;
+        if (c == '\n') *--dst = '\r';
+    }
+    stream->newlines = 0;
+    return added;
+}
 
-    if (val < 0) {
-        if (fputc('-', stream) == EOF) return EOF;
-        val = -val;
-        count++;
+// File bytes behind the read-ahead from buffer[from] on, raw bytes included; a '\n' is two when DOS_STREAM_CRLF
+static dos_file_position_t file_bytes(const FILE* stream, uint16_t from) {
+    dos_file_position_t n = stream->count - from + stream->raw;
+    if (stream->flags & DOS_STREAM_CRLF) {
+        const char* end = stream->buffer + stream->count;
+        for (const char* p = stream->buffer + from; p < end; p++) n += (*p == '\n');
     }
+    return n;
+}
 
-    long int_part = (long)val;
-    int n = print_int(int_part, 10, stream);
-    if (n == EOF) return EOF;
-    count += n;
+static dos_file_position_t unread(const FILE* stream) {
+    return file_bytes(stream, stream->next);
+}
 
-    if (fputc('.', stream) == EOF) return EOF;
-    count++;
+// Write out pending output, or drop read-ahead and move the DOS file pointer back to the stream position
+static int flush(FILE* stream) {
+    if (stream->flags & DOS_STREAM_WRITING) {
+        uint16_t n = stream->count;
+        if (n == 0) return 0;
+        n += expand(stream);
+        stream->count = 0;
+        return write_out(stream, stream->buffer, n) ? 0 : EOF;
+    }
 
-    double frac = val - int_part;
-    if (frac < 0) frac = -frac;
-    long frac_part = (long)(frac * 1000);
+    dos_file_position_t back = unread(stream);
+    stream->count = stream->next = stream->raw = 0;
+    if (back) seek_to(stream, -back, SEEK_CUR);     // fails on devices: nothing to undo
+    return 0;
+}
 
-    if (frac_part == 0) {
-        if (fputs("000", stream) == EOF) return EOF;
-        count += 3;
-    } else {
-        char buf[4];
-        char *p = buf + 3;
-        *p = '\0';
-        while (frac_part > 0 && p > buf) {
-            *--p = '0' + (frac_part % 10);
-            frac_part /= 10;
+static bool set_writing(FILE* stream) {
+    if (!stream || !(stream->flags & DOS_STREAM_WRITE)) {
+        errno = EBADF;
+        return false;
+    }
+    if (!(stream->flags & DOS_STREAM_WRITING)) {
+        flush(stream);
+        attach_buffer(stream);
+        stream->flags |= DOS_STREAM_WRITING;
+        if (!flush_at_exit && (stream->mode != _IONBF || stream == stdout))    // stdout may leave the console raw
+            flush_at_exit = dos_atexit(flush_all) == 0;
+    }
+    return true;
+}
+
+static bool set_reading(FILE* stream) {
+    if (!stream || !(stream->flags & DOS_STREAM_READ)) {
+        errno = EBADF;
+        return false;
+    }
+    if (stream->flags & DOS_STREAM_WRITING) {
+        if (flush(stream) == EOF) return false;
+        stream->flags &= ~DOS_STREAM_WRITING;
+    }
+    attach_buffer(stream);
+    return true;
+}
+
+// Queue output untranslated; a text '\n' also takes a byte for its '\r' (added at flush).
+// Binary runs that fill an empty buffer go straight to DOS.
+static bool put(FILE* stream, const char* s, size_t n) {
+    bool text = (stream->flags & DOS_STREAM_TEXT) != 0;
+    if (!text && stream->count == 0 && n >= stream->size) return write_out(stream, s, n);
+    while (n) {
+        uint16_t room = stream->size - stream->count - stream->newlines;
+        uint16_t run = (room > n) ? (uint16_t)n : room;
+        if (text) {
+            uint16_t i = 0;
+            while (i < run && s[i] != '\n') i++;
+            if (i < run) {
+                run = (i + 1 < room) ? i + 1 : i;
+                if (run > i) stream->newlines++;
+            }
         }
-        while (p > buf) *--p = '0';
-        if (fputs(buf, stream) == EOF) return EOF;
-        count += 3;
+        if (run == 0) {             // full (a text buffer holds at least a '\n' and its '\r')
+            if (flush(stream) == EOF) return false;
+            continue;
+        }
+        memcpy(stream->buffer + stream->count, s, run);
+        stream->count += run;
+        s += run;
+        n -= run;
     }
-    return count;
+    return true;
 }
 
-static int print_scientific(double val, bool uppercase, FILE* stream) {
-    int count = 0;
+// Write n bytes through the stream buffer; an unbuffered stream borrows a stack buffer for the call
+static int emit(FILE* stream, const char* s, size_t n) {
+    if (!set_writing(stream)) return EOF;
+
+    if (stream->size == 0) {
+        char spill[DOS_STDIO_FORMAT_MAX];
+        stream->buffer = spill;
+        stream->size = sizeof(spill);
+        bool ok = put(stream, s, n) && flush(stream) == 0;
+        stream->buffer = NULL;
+        stream->size = stream->count = stream->newlines = 0;
+        return ok ? 0 : EOF;
+    }
 
-    if (val < 0) {
-        if (fputc('-', stream) == EOF) return EOF;
-        val = -val;
-        count++;
+    if (!put(stream, s, n)) return EOF;
+    if (stream->mode == _IOLBF)
+        for (size_t i = n; i-- > 0; )
+            if (s[i] == '\n') return flush(stream);
+    return 0;
+}
+
+// One DOS read into dst; 0 at end of file or on error
+static uint16_t read_in(FILE* stream, char* dst, size_t n) {
+    uint16_t done = 0;
+    if (stream == stdin) {
+        flush(stdout);      // the prompt before the input
+        console_mode(false);
     }
+    dos_error_code_t err = dos_read_file(stream->handle, (uint16_t)n, dst, &done);
+    if (err != DOS_SUCCESS) {
+        errno = dos_to_errno(err);
+        return 0;
+    }
+    advance(stream, done);
+    if (done == 0 && n) {
+        stream->flags |= DOS_STREAM_EOF;
+        stream->length = stream->pos;
+    }
+    return done;
+}
 
-    if (val == 0.0) {
-        if (fputs("0.000e0", stream) == EOF) return EOF;
-        return 7;
+// Text input: drop the '\r' of each "\r\n" in [p, end) and return the new end; a '\r' ending the data
+// is kept, the caller finds out what follows it
+static char* collapse(char* p, const char* end) {
+    char* out = p;
+    while (p < end) {
+        char c = *p++;
+        if (c != '\r' || p == end || *p != '\n') *out++ = c;
     }
+    return out;
+}
 
-    int exp = 0;
-    while (val >= 10.0) { val /= 10.0; exp++; }
-    while (val < 1.0)   { val *= 10.0; exp--; }
+// Unbuffered text input: read straight into dst and collapse it there; a final '\r' reads one byte more
+static uint16_t read_text(FILE* stream, char* dst, size_t n) {
+    char* end = collapse(dst, dst + read_in(stream, dst, n));
+    char c;
+    if (end > dst && end[-1] == '\r' && read_in(stream, &c, 1) == 1) {
+        if (c == '\n') end[-1] = '\n';
+        else seek_to(stream, -1, SEEK_CUR);     // not '\n': read it again next time
+    }
+    return (uint16_t)(end - dst);
+}
 
-    int n = print_float(val, stream);
-    if (n == EOF) return EOF;
-    count += n;
+// Text input: turn the raw bytes after buffer[count] into text, "\r\n" to '\n', and return how many were added.
+// All line ends in the buffer are of one kind (DOS_STREAM_CRLF) so the file offset of each byte is known: the
+// first of the other kind waits in the raw bytes for a later refill, as does a '\r' ending them unless last.
+static uint16_t translate(FILE* stream, bool any, bool last) {
+    char* out = stream->buffer + stream->count;
+    const char* p = out;
+    const char* end = p + stream->raw;
+    while (p < end) {
+        char c = *p;
+        if (c == '\r' && p + 1 == end && !last) break;     // what follows it is not read yet
+        bool crlf = c == '\r' && p + 1 < end && p[1] == '\n';
+        if (crlf || c == '\n') {
+            if (any) {
+                if (crlf) stream->flags |= DOS_STREAM_CRLF;
+                else stream->flags &= ~DOS_STREAM_CRLF;
+                any = false;
+            } else if (crlf != ((stream->flags & DOS_STREAM_CRLF) != 0)) {
+                break;
+            }
+            p += crlf;
+            c = '\n';
+        }
+        *out++ = c;
+        p++;
+    }
+    uint16_t added = (uint16_t)(out - (stream->buffer + stream->count));
+    stream->count += added;
+    stream->raw = (uint16_t)(end - p);
+    for (uint16_t i = 0; i < stream->raw; i++) out[i] = p[i];     // forward: overlap safe
+    return added;
+}
 
-    if (fputc(uppercase ? 'E' : 'e', stream) == EOF) return EOF;
-    count++;
+// Move the unread bytes to the start of the buffer and read more after them; 0 at end of file, on error or when full
+static uint16_t refill(FILE* stream) {
+    uint16_t keep = stream->count - stream->next;
+    if (stream->next) {
+        for (uint16_t i = 0; i < keep + stream->raw; i++) stream->buffer[i] = stream->buffer[stream->next + i];
+        stream->next = 0;
+        stream->count = keep;
+    }
+    bool text = (stream->flags & DOS_STREAM_TEXT) != 0;
+    bool any = true;        // no line end kept: the new bytes may have either kind
+    for (uint16_t i = 0; any && i < keep; i++) any = stream->buffer[i] != '\n';
+    for (;;) {
+        if (stream->raw) {
+            uint16_t added = translate(stream, any, false);
+            if (added) return added;
+        }
+        uint16_t used = stream->count + stream->raw;
+        if (used >= stream->size && keep) return 0;     // raw bytes wait until the unread ones are taken
+        uint16_t done = (used >= stream->size) ? 0 : read_in(stream, stream->buffer + used, stream->size - used);
+        if (done == 0)              // end of file: a waiting '\r' is just a '\r'
+            return stream->raw ? translate(stream, any, true) : 0;
+        if (!text) {
+            stream->count += done;
+            return done;
+        }
+        stream->raw += done;
+    }
+}
 
-    n = print_int(exp, 10, stream);
-    if (n == EOF) return EOF;
-    count += n;
+// Read up to n bytes: from the read-ahead, refilled a buffer at a time; requests as big as the buffer go straight to DOS
+static size_t take(FILE* stream, char* dst, size_t n) {
+    size_t got = 0;
+    if (!set_reading(stream)) return 0;
+
+    while (got < n) {
+        uint16_t have = stream->count - stream->next;
+        if (have) {
+            if (have > n - got) have = (uint16_t)(n - got);
+            memcpy(dst + got, stream->buffer + stream->next, have);
+            stream->next += have;
+            got += have;
+            continue;
+        }
 
-    return count;
+        if (stream->size == 0 && (stream->flags & DOS_STREAM_TEXT)) {
+            uint16_t done = read_text(stream, dst + got, n - got);
+            if (done == 0) break;
+            got += done;
+        } else if (n - got >= stream->size && !(stream->flags & DOS_STREAM_TEXT)) {
+            stream->count = stream->next = 0;   // the used read-ahead no longer lies just behind pos
+            uint16_t done = read_in(stream, dst + got, n - got);
+            if (done == 0) break;   // end of file
+            got += done;
+        } else if (refill(stream) == 0) {
+            break;
+        }
+    }
+    return got;
+}
+
+int setvbuf(FILE* stream, char* buf, int mode, size_t size) {
+    if (!stream || !(stream->flags & DOS_STREAM_OPEN) || mode < _IOFBF || mode > _IONBF ||
+        (mode != _IONBF && size < ((stream->flags & DOS_STREAM_TEXT) ? 2 : 1))) {   // text: room for "\r\n"
+        errno = EINVAL;
+        return EOF;
+    }
+    if (flush(stream) == EOF) return EOF;
+    release_buffer(stream);
+    stream->mode = (uint8_t)mode;
+    stream->buffer = (mode == _IONBF) ? NULL : buf;
+    stream->size = (mode == _IONBF) ? 0 : (uint16_t)size;
+    stream->flags &= ~DOS_STREAM_WRITING;
+    return 0;
+}
+
+int fflush(FILE* stream) {
+    if (!stream) {
+        int result = 0;
+        for (int i = 0; i < FOPEN_MAX; i++)
+            if ((dos_streams[i].flags & DOS_STREAM_WRITING) && flush(&dos_streams[i]) == EOF) result = EOF;
+        return result;
+    }
+    if (!(stream->flags & DOS_STREAM_OPEN)) {
+        errno = EBADF;
+        return EOF;
+    }
+    return flush(stream);
+}
+
+int dos_stdio_set_console(dos_console_write_t write, void* ctx) {
+    uint16_t info = 0;
+    if (write && (dos_get_device_info(stdout->handle, &info) != DOS_SUCCESS ||
+                  !(info & DOS_DEV_CHAR) || !(info & DOS_DEV_STDOUT))) {
+        errno = ENODEV;
+        return EOF;
+    }
+    fflush(stdout);         // what is pending goes the old way
+    console_mode(false);
+    console_write = write;
+    console_ctx = ctx;
+    return 0;
 }
-#endif // USE_DOSLIBC_FLOAT_PRINTF
 
 // Core I/O primitives
 
 int fputc(int c, FILE* stream) {
-    dos_file_handle_t handle = (dos_file_handle_t)(uintptr_t)stream;
-    dos_error_code_t err = 0;
-    char buffer[2];
-    uint16_t nbytes = 1;
-
-    if (c == '\n' && (stream == stdout || stream == stderr)) {
-        buffer[0] = '\r';
-        buffer[1] = '\n';
-        nbytes = 2;
-    } else {
-        buffer[0] = c;
+    char ch = (char)c;
+    if (stream && (stream->flags & DOS_STREAM_WRITING) && stream->count + stream->newlines < stream->size && ch != '\n') {
+        stream->buffer[stream->count++] = ch;   // fast path: room in the buffer
+        return (unsigned char)ch;
+    }
+    return (emit(stream, &ch, 1) == EOF) ? EOF : (unsigned char)ch;
+}
+
+int fputs(const char* str, FILE* stream) {
+    if (!str) {
+        errno = EINVAL;
+        return EOF;
     }
+    return (emit(stream, str, strlen(str)) == EOF) ? EOF : 0;
+}
 
-    __asm {
-        .8086
-        pushf
-        push    ds
-        push    si
+// Core formatted output
+
+/**
+ * One formatter, two sinks: a stream sink renders into a stack buffer that
+ * is handed to the stream when it fills and at the end of the call (one
+ * write per call for short output, even on unbuffered streams); a memory
+ * sink renders straight into the caller's buffer and drops what does not
+ * fit. Write errors are sticky and reported at the end.
+ */
+typedef struct format_s format_t;
+
+struct format_s {
+    char*   buf;                        // rendered output goes here
+    size_t  size;
+    size_t  len;
+    bool    failed;
+    void  (*spill)(format_t* out);      // buf is full, or the call ends
+    FILE*   stream;                     // stream sink only
+};
+
+static void spill_stream(format_t* out) {
+    if (out->len && emit(out->stream, out->buf, out->len) == EOF) out->failed = true;
+    out->len = 0;
+}
 
-        mov     bx, handle
-        mov     cx, nbytes
-        lea     dx, buffer
-        mov     ah, DOS_WRITE_FILE_OR_DEVICE_USING_HANDLE
-        int     DOS_SERVICE
-        jnc     END
-        mov     err, ax
+static void spill_memory(format_t* out) {
+    (void)out;                          // full: the rest is counted, not stored
+}
 
-END:    pop     si
-        pop     ds
-        popf
+static int out_char(format_t* out, char c) {
+    if (out->len == out->size) {
+        out->spill(out);
+        if (out->len == out->size) return 1;
     }
+    out->buf[out->len++] = c;
+    return 1;
+}
 
-    if (err != 0) {
-        errno = dos_to_errno(err);
-        return EOF;
+static int out_mem(format_t* out, const char* s, size_t n) {
+    size_t left = n;
+    while (left) {
+        if (out->len == out->size) {
+            out->spill(out);
+            if (out->len == out->size) break;   // memory sink full: counted only
+        }
+        size_t room = out->size - out->len;
+        if (room > left) room = left;
+        memcpy(out->buf + out->len, s, room);
+        out->len += room;
+        s += room;
+        left -= room;
     }
+    return (int)n;
+}
 
-    return (unsigned char)c;
+static int out_str(format_t* out, const char* s) {
+    return out_mem(out, s, strlen(s));
 }
 
-int fputs(const char* str, FILE* stream) {
-    while (*str) {
-        if (fputc(*str++, stream) == EOF) return EOF;
+static int out_fill(format_t* out, char c, int n) {
+    int count = 0;
+    while (count < n) count += out_char(out, c);
+    return count;
+}
+
+// Conversion flags
+#define FORMAT_LEFT     0x01    // '-'
+#define FORMAT_ZERO     0x02    // '0'
+#define FORMAT_PLUS     0x04    // '+'
+#define FORMAT_SPACE    0x08    // ' '
+#define FORMAT_ALT      0x10    // '#'
+
+typedef struct {
+    uint8_t flags;
+    int     width;
+    int     precision;          // -1: none given
+} format_spec_t;
+
+static const format_spec_t plain_spec = {0, 0, -1};
+
+static const char digit_pairs[] =
+    "00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839"
+    "40414243444546474849" "50515253545556575859" "60616263646566676869" "70717273747576777879"
+    "80818283848586878889" "90919293949596979899";
+
+/**
+ * Digits of val written backwards ending at end, returns the first one.
+ * Decimal goes two digits per division, with 32-bit division only while
+ * the value needs it (unsigned int is 16-bit on the 8086); octal and hex
+ * are shifts.
+ */
+static char* format_digits(char* end, unsigned long val, unsigned int base, bool uppercase) {
+    char* p = end;
+    if (base == 10) {
+        while (val > 0xFFFFUL) {
+            unsigned long q = val / 100;
+            const char* pair = digit_pairs + 2 * (unsigned int)(val - q * 100);
+            *--p = pair[1];
+            *--p = pair[0];
+            val = q;
+        }
+        unsigned int v = (unsigned int)val;
+        while (v >= 100) {
+            unsigned int q = v / 100;
+            const char* pair = digit_pairs + 2 * (v - q * 100);
+            *--p = pair[1];
+            *--p = pair[0];
+            v = q;
+        }
+        if (v >= 10) {
+            *--p = digit_pairs[2 * v + 1];
+            *--p = digit_pairs[2 * v];
+        } else {
+            *--p = (char)('0' + v);
+        }
+    } else {
+        const char* digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+        unsigned int shift = (base == 16) ? 4 : 3;
+        do {
+            *--p = digits[(unsigned int)val & (base - 1)];
+            val >>= shift;
+        } while (val);
     }
-    return 0;
+    return p;
 }
 
-// Core formatted output
+// Integer with sign or prefix, precision (minimum digits), width and padding
+static int print_number(format_t* out, const format_spec_t* spec, unsigned long val, char sign,
+                        unsigned int base, bool uppercase) {
+    char buf[12];                       // 32-bit octal: 11 digits
+    char* end = buf + sizeof(buf);
+    char* p = (val == 0 && spec->precision == 0) ? end : format_digits(end, val, base, uppercase);
+    int digits = (int)(end - p);
+    int zeros = (spec->precision > digits) ? spec->precision - digits : 0;
+
+    const char* prefix = "";
+    if (spec->flags & FORMAT_ALT) {
+        if (base == 16 && val) prefix = uppercase ? "0X" : "0x";
+        else if (base == 8 && zeros == 0 && (digits == 0 || *p != '0')) zeros = 1;
+    }
+    int prefix_len = (sign ? 1 : 0) + (int)strlen(prefix);
 
-int fprintf(FILE* stream, const char* format, ...) {
-    va_list args;
-    va_start(args, format);
+    int pad = spec->width - (prefix_len + zeros + digits);
+    if (pad < 0) pad = 0;
+    if ((spec->flags & (FORMAT_ZERO | FORMAT_LEFT)) == FORMAT_ZERO && spec->precision < 0) {
+        zeros += pad;
+        pad = 0;
+    }
+
+    int count = 0;
+    if (!(spec->flags & FORMAT_LEFT)) count += out_fill(out, ' ', pad);
+    if (sign) count += out_char(out, sign);
+    count += out_str(out, prefix);
+    count += out_fill(out, '0', zeros);
+    count += out_mem(out, p, (size_t)digits);
+    if (spec->flags & FORMAT_LEFT) count += out_fill(out, ' ', pad);
+    return count;
+}
 
+static int print_signed(format_t* out, const format_spec_t* spec, long val) {
+    char sign = 0;
+    if (val < 0) sign = '-';
+    else if (spec->flags & FORMAT_PLUS) sign = '+';
+    else if (spec->flags & FORMAT_SPACE) sign = ' ';
+    unsigned long magnitude = (val < 0) ? 0UL - (unsigned long)val : (unsigned long)val;   // LONG_MIN too
+    return print_number(out, spec, magnitude, sign, 10, false);
+}
+
+// Text padded to width; precision limits the length
+static int print_text(format_t* out, const format_spec_t* spec, const char* s, size_t n) {
+    if (spec->precision >= 0 && n > (size_t)spec->precision) n = (size_t)spec->precision;
+    int pad = spec->width - (int)n;
+    int count = 0;
+    if (pad > 0 && !(spec->flags & FORMAT_LEFT)) count += out_fill(out, ' ', pad);
+    count += out_mem(out, s, n);
+    if (pad > 0 && (spec->flags & FORMAT_LEFT)) count += out_fill(out, ' ', pad);
+    return count;
+}
+
+#ifdef USE_DOSLIBC_FLOAT_PRINTF
+static int print_float(format_t* out, double val) {
+    int count = 0;
+
+    if (val < 0) {
+        count += out_char(out, '-');
+        val = -val;
+    }
+
+    long int_part = (long)val;
+    count += print_signed(out, &plain_spec, int_part);
+    count += out_char(out, '.');
+
+    double frac = val - int_part;
+    if (frac < 0) frac = -frac;
+    format_spec_t three = {FORMAT_ZERO, 3, -1};
+    return count + print_number(out, &three, (unsigned long)(frac * 1000), 0, 10, false);
+}
+
+static int print_scientific(format_t* out, double val, bool uppercase) {
+    int count = 0;
+
+    if (val < 0) {
+        count += out_char(out, '-');
+        val = -val;
+    }
+
+    if (val == 0.0) return count + out_str(out, "0.000e0");
+
+    int exp = 0;
+    while (val >= 10.0) { val /= 10.0; exp++; }
+    while (val < 1.0)   { val *= 10.0; exp--; }
+
+    count += print_float(out, val);
+    count += out_char(out, uppercase ? 'E' : 'e');
+    return count + print_signed(out, &plain_spec, exp);
+}
+#endif // USE_DOSLIBC_FLOAT_PRINTF
+
+// Render format into out; returns the number of characters produced, stored or not
+static int render(format_t* out, const char* format, va_list args) {
     int count = 0;
     const char* p = format;
 
     while (*p) {
         if (*p != '%') {
-            if (fputc(*p, stream) == EOF) { va_end(args); return EOF; }
-            count++;
-            p++;
+            const char* run = p;
+            while (*p && *p != '%') p++;
+            count += out_mem(out, run, (size_t)(p - run));
             continue;
         }
 
-        p++;  /* skip '%' */
+        const char* start = p++;    /* skip '%' */
+        format_spec_t spec = plain_spec;
+
+        for (;; p++) {
+            if (*p == '-') spec.flags |= FORMAT_LEFT;
+            else if (*p == '0') spec.flags |= FORMAT_ZERO;
+            else if (*p == '+') spec.flags |= FORMAT_PLUS;
+            else if (*p == ' ') spec.flags |= FORMAT_SPACE;
+            else if (*p == '#') spec.flags |= FORMAT_ALT;
+            else break;
+        }
+        if (*p == '*') {
+            spec.width = va_arg(args, int);
+            if (spec.width < 0) {
+                spec.flags |= FORMAT_LEFT;
+                spec.width = -spec.width;
+            }
+            p++;
+        } else {
+            while (*p >= '0' && *p <= '9') spec.width = spec.width * 10 + (*p++ - '0');
+        }
+        if (*p == '.') {
+            p++;
+            spec.precision = 0;
+            if (*p == '*') {
+                spec.precision = va_arg(args, int);
+                if (spec.precision < 0) spec.precision = -1;
+                p++;
+            } else {
+                while (*p >= '0' && *p <= '9') spec.precision = spec.precision * 10 + (*p++ - '0');
+            }
+        }
 
         bool is_long = false;
+        bool is_short = false;
         if (*p == 'l') {
             is_long = true;
             p++;
+        } else if (*p == 'h') {
+            is_short = true;
+            p++;
         }
 
-        int n = 0;
+        unsigned long u;
         switch (*p++) {
-            case 'c':
-                n = (fputc(va_arg(args, int), stream) == EOF) ? EOF : 1;
+            case 'c': {
+                char c = (char)va_arg(args, int);
+                count += print_text(out, &spec, &c, 1);
                 break;
+            }
 
             case 's': {
-                char* str = va_arg(args, char*);
+                const char* str = va_arg(args, char*);
                 if (!str) str = "(null)";
-                while (*str) {
-                    if (fputc(*str++, stream) == EOF) { n = EOF; break; }
-                    count++;
-                }
-                if (n != EOF) n = 0;
+                size_t n = 0;
+                while (str[n] && (spec.precision < 0 || n < (size_t)spec.precision)) n++;
+                count += print_text(out, &spec, str, n);
                 break;
             }
 
             case 'd':
-            case 'i':
-                n = is_long ? print_int(va_arg(args, long), 10, stream)
-                            : print_int(va_arg(args, int), 10, stream);
+            case 'i': {
+                long v = is_long ? va_arg(args, long) : va_arg(args, int);
+                if (is_short) v = (short)v;
+                count += print_signed(out, &spec, v);
                 break;
+            }
 
             case 'u':
-                n = is_long ? print_uint(va_arg(args, unsigned long), 10, stream)
-                            : print_uint(va_arg(args, unsigned int), 10, stream);
-                break;
-
             case 'x':
-                n = is_long ? print_hex(va_arg(args, unsigned long), false, stream)
-                            : print_hex(va_arg(args, unsigned int), false, stream);
-                break;
-
-            case 'p':
             case 'X':
-                n = is_long ? print_hex(va_arg(args, unsigned long), true, stream)
-                            : print_hex(va_arg(args, unsigned int), true, stream);
+            case 'o':
+                u = is_long ? va_arg(args, unsigned long) : va_arg(args, unsigned int);
+                if (is_short) u = (unsigned short)u;
+                count += print_number(out, &spec, u, 0,
+                                      (p[-1] == 'o') ? 8 : (p[-1] == 'u') ? 10 : 16, p[-1] == 'X');
                 break;
 
-            case 'o':
-                n = is_long ? print_uint(va_arg(args, unsigned long), 8, stream)
-                            : print_uint(va_arg(args, unsigned int), 8, stream);
+            case 'p':
+                u = (unsigned long)(uintptr_t)va_arg(args, void*);     // far: segment:offset
+                count += print_number(out, &spec, u, 0, 16, true);
                 break;
 
 #ifdef USE_DOSLIBC_FLOAT_PRINTF
             case 'f':
-                n = print_float(va_arg(args, double), stream);
+                count += print_float(out, va_arg(args, double));
                 break;
             case 'e':
-                n = print_scientific(va_arg(args, double), false, stream);
+                count += print_scientific(out, va_arg(args, double), false);
                 break;
             case 'E':
-                n = print_scientific(va_arg(args, double), true, stream);
+                count += print_scientific(out, va_arg(args, double), true);
                 break;
 #endif // USE_DOSLIBC_FLOAT_PRINTF
 
             case '%':
-                n = (fputc('%', stream) == EOF) ? EOF : 1;
+                count += out_char(out, '%');
                 break;
 
-            default:
-                if (fputc('%', stream) == EOF || fputc(p[-1], stream) == EOF)
-                    n = EOF;
-                else
-                    n = 2;
+            default:                        // unknown conversion: copied as written
+                if (!p[-1]) p--;            // '%' at the end of the format
+                count += out_mem(out, start, (size_t)(p - start));
                 break;
         }
-
-        if (n == EOF) { va_end(args); return EOF; }
-        count += n;
     }
 
+    out->spill(out);
+    return count;
+}
+
+int vfprintf(FILE* stream, const char* format, va_list args) {
+    char buf[DOS_STDIO_FORMAT_MAX];
+    format_t out;
+    out.buf = buf;
+    out.size = sizeof(buf);
+    out.len = 0;
+    out.failed = false;
+    out.spill = spill_stream;
+    out.stream = stream;
+
+    int count = render(&out, format, args);
+    return out.failed ? EOF : count;
+}
+
+int fprintf(FILE* stream, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int count = vfprintf(stream, format, args);
     va_end(args);
     return count;
 }
 
+int vsnprintf(char* s, size_t n, const char* format, va_list args) {
+    format_t out;
+    out.buf = s;
+    out.size = n ? n - 1 : 0;           // room for the terminator
+    out.len = 0;
+    out.failed = false;
+    out.spill = spill_memory;
+    out.stream = NULL;
+
+    int count = render(&out, format, args);
+    if (n) s[out.len] = '\0';
+    return count;
+}
+
+int snprintf(char* s, size_t n, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int count = vsnprintf(s, n, format, args);
+    va_end(args);
+    return count;
+}
+
+int vsprintf(char* s, const char* format, va_list args) {
+    return vsnprintf(s, (size_t)-1, format, args);     // one segment at most
+}
+
+int sprintf(char* s, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int count = vsnprintf(s, (size_t)-1, format, args);
+    va_end(args);
+    return count;
+}
+
+
 int printf_(const char* format, ...) {
     // This symbol satisfies linker, but code should use macro
     va_list args;
     va_start(args, format);
-    int result = fprintf(stdout, format, args);  // Your actual logic
+    int result = vfprintf(stdout, format, args);
     va_end(args);
     return result;
 }
@@ -290,39 +835,358 @@ int printf_(const char* format, ...) {
 // Input functions
 
 int fgetc(FILE* stream) {
-    char buffer;
-    uint16_t bytes_read = 0;
-    dos_error_code_t err;
-
-    err = dos_read_file((dos_file_handle_t)(uintptr_t)stream, 1, &buffer, &bytes_read);
-
-    if (err != DOS_SUCCESS || bytes_read == 0) return EOF;
-    return (unsigned char)buffer;
+    char c;
+    if (stream && !(stream->flags & DOS_STREAM_WRITING) && stream->next < stream->count)
+        return (unsigned char)stream->buffer[stream->next++];   // fast path: read-ahead
+    return (take(stream, &c, 1) == 1) ? (unsigned char)c : EOF;
 }
 
 char* fgets(char* s, int size, FILE* stream) {
     if (!s || !stream || size <= 0) return NULL;
+    if (!set_reading(stream)) return NULL;
 
     char* p = s;
     int remaining = size - 1;  // Reserve space for null terminator
 
     while (remaining > 0) {
-        int c = fgetc(stream);  // Use core primitive; handles all streams
+        uint16_t have = stream->count - stream->next;
+        if (have == 0) {
+            int c = fgetc(stream);  // refills the read-ahead (a byte at a time if unbuffered)
+            if (c == EOF) break;
+            *p++ = (char)c;
+            remaining--;
+            if (c == '\n') break;
+            continue;
+        }
+
+        // Copy up to the newline straight out of the read-ahead
+        const char* from = stream->buffer + stream->next;
+        if (have > remaining) have = (uint16_t)remaining;
+        uint16_t n = 0;
+        while (n < have && from[n] != '\n') n++;
+        if (n < have) n++;
+        memcpy(p, from, n);
+        p += n;
+        stream->next += n;
+        remaining -= n;
+        if (p[-1] == '\n') break;  // Line complete
+    }
 
-        if (c == EOF) {
-            // EOF/error: return NULL if nothing read, else partial line
-            if (p == s) return NULL;
+    if (p == s) return NULL;    // EOF/error before anything was read
+    *p = '\0';  // Always null-terminate
+    return s;
+}
+
+char* fgetln(FILE* stream, size_t* len) {
+    if (!len || !set_reading(stream)) return NULL;
+    if (stream->size == 0) {
+        errno = EINVAL;     // unbuffered: nothing to point into
+        return NULL;
+    }
+
+    uint16_t scanned = 0;   // bytes of the line already searched for '\n'
+    for (;;) {
+        const char* p = stream->buffer + stream->next + scanned;
+        const char* end = stream->buffer + stream->count;
+        while (p < end && *p != '\n') p++;
+        if (p < end) {
+            scanned = (uint16_t)(p + 1 - (stream->buffer + stream->next));
+            break;
+        }
+        scanned = stream->count - stream->next;
+        if (refill(stream) == 0) {      // end of file, or the line fills the buffer
+            if (scanned == 0) return NULL;
             break;
         }
+    }
 
-        *p++ = (char)c;
-        remaining--;
+    char* line = stream->buffer + stream->next;
+    stream->next += scanned;
+    *len = scanned;
+    return line;
+}
 
-        if (c == '\n') break;  // Line complete
+// Formatted input
+
+#define SCAN_SPACE  " \t\n\r\v\f"
+#define SCAN_DIGITS "0123456789"
+
+/**
+ * The scanf core runs SNO primitives over a view of the input: the string
+ * for sscanf, the read-ahead for fscanf. Before a conversion the stream view
+ * is topped up (compacting the buffer like fgetln) until the field ends in
+ * it: at white space, at the first byte outside a %[ set, after the width of
+ * a %c. So no field is cut at a refill unless it is longer than the buffer.
+ * A width narrows the view the conversion sees.
+ */
+typedef struct {
+    view_t   s;             // unread input
+    FILE*    stream;        // NULL for a string
+    unsigned consumed;      // input before mark (for %n)
+    cursor_t mark;
+} scan_t;
+
+// Hand the position back to the stream
+static void scan_sync(scan_t* in) {
+    in->consumed += (unsigned)(in->s.begin - in->mark);
+    in->mark = in->s.begin;
+    if (in->stream) in->stream->next = (uint16_t)(in->s.begin - in->stream->buffer);
+}
+
+// Where a field starting at begin is sure to end, searched from from on: after need bytes (0: no limit), or at
+// the first byte in set (exclude) or outside it (!exclude, as %[); NULL if that is not in [begin, end)
+static cursor_t scan_stop(cursor_t begin, cursor_t from, cursor_t end, size_t need, const char* set, bool exclude) {
+    if (need && (size_t)(end - begin) >= need) return begin + need;
+    if (!set) return NULL;
+    for (; from < end; from++)
+        if ((*from && strchr(set, *from)) == exclude) return from;
+    return NULL;
+}
+
+// Top the view up until the next field ends in it (see scan_stop) or the buffer is full; false when no input is left
+static bool scan_more(scan_t* in, size_t need, const char* set, bool exclude) {
+    if (in->stream && !scan_stop(in->s.begin, in->s.begin, in->s.end, need, set, exclude)) {
+        FILE* stream = in->stream;
+        scan_sync(in);
+        uint16_t scanned = stream->count - stream->next;
+        while (refill(stream)) {
+            cursor_t begin = stream->buffer;        // compacted: the view starts at buffer[0]
+            if (scan_stop(begin, begin + scanned, begin + stream->count, need, set, exclude)) break;
+            scanned = stream->count;
+        }
+        in->s = view(stream->buffer + stream->next, stream->buffer + stream->count);
+        in->mark = in->s.begin;
     }
+    return in->s.begin < in->s.end;
+}
 
-    *p = '\0';  // Always null-terminate
-    return s;
+static void scan_space(scan_t* in) {
+    while (skip(&in->s, SCAN_SPACE) && in->s.begin == in->s.end && scan_more(in, 1, NULL, false)) {}
+}
+
+// [sign] digits in base 10, 16 ("0x" optional), 8, or 0 (prefix decides, as %i)
+static bool scan_integer(view_t* field, unsigned int base, unsigned long* value) {
+    view_t f = *field;
+    bool negative = (f.begin < f.end && *f.begin == '-');
+    any(&f, "+-");
+
+    view_t x = f;
+    bool prefixed = (base == 0 || base == 16) && chr(&x, '0') && any(&x, "xX") && hexnum(&x, value);
+    if (prefixed) {
+        f = x;
+    } else {
+        if (base == 0) base = (f.begin < f.end && *f.begin == '0') ? 8 : 10;
+        if (base == 16) {
+            if (!hexnum(&f, value)) return false;
+        } else if (base == 8) {
+            if (!octnum(&f, value)) return false;
+        } else {
+            cursor_t digits = f.begin;
+            if (!span(&f, SCAN_DIGITS)) return false;
+            unsigned long v = 0;
+            while (digits < f.begin) v = v * 10 + (unsigned long)(*digits++ - '0');
+            *value = v;
+        }
+    }
+    if (negative) *value = 0UL - *value;
+    *field = f;
+    return true;
+}
+
+// Charset of a %[...] scanset, ranges expanded; returns the format after ']' or NULL if unterminated
+static const char* scan_set(const char* p, char* set, bool* exclude) {
+    unsigned int n = 0;
+    *exclude = (*p == '^');
+    if (*exclude) p++;
+    if (*p == ']') set[n++] = *p++;     // leading ']' is a member
+    while (*p && *p != ']') {
+        if (p[1] == '-' && p[2] && p[2] != ']') {
+            for (unsigned int c = (unsigned char)p[0]; c <= (unsigned char)p[2] && n < 255; c++)
+                if (c) set[n++] = (char)c;
+            p += 3;
+        } else if (n < 255) {
+            set[n++] = *p++;
+        } else {
+            p++;
+        }
+    }
+    set[n] = '\0';
+    return *p ? p + 1 : NULL;
+}
+
+// Returns the number of assigned fields, or EOF if the input ended before the first conversion
+static int scan(scan_t* in, const char* format, va_list args) {
+    int assigned = 0;
+    bool converted = false;
+    const char* p = format;
+
+    while (*p) {
+        if (strchr(SCAN_SPACE, *p)) {
+            while (*p && strchr(SCAN_SPACE, *p)) p++;
+            scan_space(in);
+            continue;
+        }
+        if (*p != '%' || p[1] == '%') {
+            char c = *p;
+            p += (c == '%') ? 2 : 1;
+            if (c == '%') scan_space(in);
+            if (!scan_more(in, 1, NULL, false)) return converted ? assigned : EOF;
+            if (!chr(&in->s, c)) break;         // matching failure
+            continue;
+        }
+
+        p++;  /* skip '%' */
+        bool suppress = (*p == '*');
+        if (suppress) p++;
+        unsigned int width = 0;
+        while (*p >= '0' && *p <= '9') width = width * 10 + (unsigned int)(*p++ - '0');
+        char length = 0;
+        if (*p == 'h' || *p == 'l') length = *p++;
+        char conv = *p++;
+        if (!conv) break;
+
+        if (conv == 'n') {
+            scan_sync(in);
+            if (!suppress) *va_arg(args, int*) = (int)in->consumed;
+            continue;
+        }
+        char set[256];
+        bool exclude = true;
+        if (conv == '[') {
+            p = scan_set(p, set, &exclude);
+            if (!p) return converted ? assigned : EOF;
+        }
+        if (conv != 'c' && conv != '[') scan_space(in);
+        bool more = (conv == 'c') ? scan_more(in, width ? width : 1, NULL, false)
+                  : scan_more(in, width, (conv == '[') ? set : SCAN_SPACE, exclude);
+        if (!more) return converted ? assigned : EOF;
+
+        view_t field = in->s;
+        if (width && width < size(field)) field.end = field.begin + width;
+
+        switch (conv) {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o': {
+                unsigned long v;
+                if (conv == 'd' && length == 0) {
+                    int n;                      // plain int: num() does it
+                    if (!num(&field, &n)) goto done;
+                    if (!suppress) *va_arg(args, int*) = n;
+                    break;
+                }
+                unsigned int base = (conv == 'i') ? 0 : (conv == 'o') ? 8 : (conv == 'x' || conv == 'X') ? 16 : 10;
+                if (!scan_integer(&field, base, &v)) goto done;
+                if (suppress) break;
+                if (length == 'l') *va_arg(args, unsigned long*) = v;
+                else if (length == 'h') *va_arg(args, unsigned short*) = (unsigned short)v;
+                else *va_arg(args, unsigned int*) = (unsigned int)v;
+                break;
+            }
+
+            case 'f':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G': {
+                double x;
+                if (!real(&field, &x)) goto done;
+                if (suppress) break;
+                if (length == 'l') *va_arg(args, double*) = x;
+                else *va_arg(args, float*) = (float)x;
+                break;
+            }
+
+            case 's': {
+                cursor_t word = field.begin;
+                brk(&field, SCAN_SPACE);
+                if (field.begin == word) goto done;
+                if (suppress) break;
+                char* dst = va_arg(args, char*);
+                while (word < field.begin) *dst++ = *word++;
+                *dst = '\0';
+                break;
+            }
+
+            case 'c': {
+                cursor_t chars = field.begin;
+                if (!len(&field, width ? width : 1)) return converted ? assigned : EOF;   // input ran out
+                if (suppress) break;
+                char* dst = va_arg(args, char*);
+                while (chars < field.begin) *dst++ = *chars++;
+                break;
+            }
+
+            case '[': {
+                cursor_t word = field.begin;
+                if (exclude) brk(&field, set);
+                else span(&field, set);
+                if (field.begin == word) goto done;
+                if (suppress) break;
+                char* dst = va_arg(args, char*);
+                while (word < field.begin) *dst++ = *word++;
+                *dst = '\0';
+                break;
+            }
+
+            default:
+                goto done;
+        }
+
+        in->s.begin = field.begin;
+        converted = true;
+        if (!suppress) assigned++;
+    }
+
+done:
+    scan_sync(in);
+    return assigned;
+}
+
+int vsscanf(const char* str, const char* format, va_list args) {
+    if (!str || !format) {
+        errno = EINVAL;
+        return EOF;
+    }
+    scan_t in;
+    in.s = bind(str);
+    in.stream = NULL;
+    in.consumed = 0;
+    in.mark = in.s.begin;
+    return scan(&in, format, args);
+}
+
+int sscanf(const char* str, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int result = vsscanf(str, format, args);
+    va_end(args);
+    return result;
+}
+
+int vfscanf(FILE* stream, const char* format, va_list args) {
+    if (!format || !set_reading(stream)) return EOF;
+    if (stream->size == 0) {
+        errno = EINVAL;     // unbuffered: no read-ahead to scan
+        return EOF;
+    }
+    scan_t in;
+    in.s = view(stream->buffer + stream->next, stream->buffer + stream->count);
+    in.stream = stream;
+    in.consumed = 0;
+    in.mark = in.s.begin;
+    return scan(&in, format, args);
+}
+
+int fscanf(FILE* stream, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int result = vfscanf(stream, format, args);
+    va_end(args);
+    return result;
 }
 
 void perror(const char *s) {
@@ -331,7 +1195,7 @@ void perror(const char *s) {
         fputs(": ", stderr);
     }
     fputs(strerror(errno), stderr);
-    fputs("\r\n", stderr);
+    fputc('\n', stderr);
 }
 
 // File handling
@@ -344,28 +1208,40 @@ FILE* fopen(const char* filename, const char* mode) {
         return NULL;
     }
 
+    FILE* stream = NULL;
+    for (int i = 3; i < FOPEN_MAX && !stream; i++)
+        if (!(dos_streams[i].flags & DOS_STREAM_OPEN)) stream = &dos_streams[i];
+    if (!stream) {
+        errno = EMFILE;
+        return NULL;
+    }
+
     dos_file_handle_t handle = 0;
     dos_error_code_t err = DOS_SUCCESS;
-    dos_file_position_t pos;
+    dos_file_position_t pos = 0, length = DOS_STDIO_UNKNOWN;     // a new handle is at offset 0
+    bool update = strchr(mode, '+') != NULL;   // "r+", "rb+", "r+b", ...
+    uint8_t flags = DOS_STREAM_OPEN | (update ? DOS_STREAM_READ | DOS_STREAM_WRITE : 0);
+    if (!strchr(mode, 'b')) flags |= DOS_STREAM_TEXT;
 
     switch (mode[0]) {
         case 'r':
             // "r" / "r+" - must exist, fail if not found
             err = dos_open_file(
                 filename,
-                (mode[1]=='+') ? ACCESS_READ_WRITE : ACCESS_READ_ONLY,
+                update ? ACCESS_READ_WRITE : ACCESS_READ_ONLY,
                 &handle
             );
             if (err) {
                 errno = dos_to_errno(err);
                 return NULL;
             }
+            flags |= DOS_STREAM_READ;
             break;
 
         case 'w':
             // "w" / "w+" - truncate or create
             // "wx" / "w+x" - exclusive create: fail if file exists
-            if (mode[1] == 'x' || mode[2] == 'x') {
+            if (strchr(mode, 'x')) {
                 // Exclusive create: try to open first; if succeeds, file exists → fail
                 err = dos_open_file(filename, ACCESS_READ_ONLY, &handle);
                 if (err == DOS_SUCCESS) {   // File exists → close probe handle and fail
@@ -381,6 +1257,8 @@ FILE* fopen(const char* filename, const char* mode) {
                 errno = dos_to_errno(err);
                 return NULL;
             }
+            length = 0;
+            flags |= DOS_STREAM_WRITE;
             break;
 
         case 'a':
@@ -391,7 +1269,10 @@ FILE* fopen(const char* filename, const char* mode) {
                 errno = dos_to_errno(err);
                 return NULL;
             }
-            dos_move_file_pointer(handle, 0, SEEK_END, &pos); // Append semantics: always seek to end
+            // Append semantics: always seek to end
+            if (dos_move_file_pointer(handle, 0, SEEK_END, &pos) == DOS_SUCCESS) length = pos;
+            else pos = DOS_STDIO_UNKNOWN;
+            flags |= DOS_STREAM_WRITE;
             break;
 
         default:
@@ -399,21 +1280,33 @@ FILE* fopen(const char* filename, const char* mode) {
             return NULL;
     }
 
+    stream->handle = handle;
+    stream->flags = flags;
+    stream->mode = _IOFBF;
+    stream->buffer = NULL;      // allocated on first I/O
+    stream->size = BUFSIZ;
+    stream->count = stream->next = stream->newlines = stream->raw = 0;
+    stream->pos = pos;
+    stream->length = length;
     errno = 0;
-    return (FILE*)(uintptr_t)handle;
+    return stream;
 }
 
 int fclose(FILE* stream) {
-    if (!stream) {
+    if (!stream || !(stream->flags & DOS_STREAM_OPEN)) {
         errno = EBADF;
         return EOF;
     }
     errno = 0;
-    dos_error_code_t err = dos_close_file((dos_file_handle_t)(uintptr_t)stream);
+    int result = (stream->flags & DOS_STREAM_WRITING) ? flush(stream) : 0;
+    release_buffer(stream);
+    stream->flags = 0;
+    dos_error_code_t err = dos_close_file(stream->handle);
     if (err) {
         errno = dos_to_errno(err);
         return EOF;
     }
+    if (result == EOF) return EOF;
     errno = 0;
     return 0;
 }
@@ -422,78 +1315,88 @@ size_t fread(void* ptr, size_t size, size_t count, FILE* stream) {
     if (!ptr || !stream || size == 0 || count == 0)
         return 0;
 
-    uint16_t bytes = (uint16_t)(size * count);
-    uint16_t done = 0;
-    dos_error_code_t err = dos_read_file(
-        (dos_file_handle_t)(uintptr_t)stream,
-        bytes,
-        (char*)ptr,
-        &done
-    );
-
-    if (err != DOS_SUCCESS) {
-        errno = dos_to_errno(err);
-        return 0;
-    }
-    return done / size;
+    return take(stream, (char*)ptr, size * count) / size;
 }
 
 size_t fwrite(const void* ptr, size_t size, size_t count, FILE* stream) {
     if (!ptr || !stream || size == 0 || count == 0)
         return 0;
 
-    uint16_t bytes = (uint16_t)(size * count);
-    uint16_t done = 0;
-    dos_error_code_t err = dos_write_file(
-        (dos_file_handle_t)(uintptr_t)stream,
-        bytes,
-        (const char*)ptr,
-        &done
-    );
+    return (emit(stream, (const char*)ptr, size * count) == EOF) ? 0 : count;
+}
 
-    if (err != DOS_SUCCESS) {
-        errno = dos_to_errno(err);
-        return 0;
+// Reading: move to file offset target without DOS if it lies in the read-ahead
+static bool seek_buffer(FILE* stream, dos_file_position_t target) {
+    if (stream->pos == DOS_STDIO_UNKNOWN || (stream->flags & DOS_STREAM_WRITING)) return false;
+    dos_file_position_t at = stream->pos - file_bytes(stream, 0);     // offset of buffer[0]
+    if (target < at || target > stream->pos - stream->raw) return false;
+    bool crlf = (stream->flags & DOS_STREAM_CRLF) != 0;
+    uint16_t i = 0;
+    while (at < target && i < stream->count) {
+        at += (crlf && stream->buffer[i] == '\n') ? 2 : 1;
+        i++;
     }
-    return done / size;
+    if (at != target) return false;     // between the '\r' and '\n' of a line end
+    stream->next = i;
+    return true;
 }
 
 int fseek(FILE* stream, long offset, int origin) {
-    if (!stream) {
+    if (!stream || !(stream->flags & DOS_STREAM_OPEN)) {
         errno = EBADF;
         return -1;
     }
-    dos_file_position_t pos = 0;
-    dos_error_code_t err = dos_move_file_pointer(
-        (dos_file_handle_t)(uintptr_t)stream,
-        (dos_file_position_t)offset,
-        (uint8_t)origin,
-        &pos
-    );
+    if ((stream->flags & DOS_STREAM_WRITING) && flush(stream) == EOF) return -1;
+    stream->flags &= ~DOS_STREAM_EOF;
+
+    // The target as an absolute offset, where pos and length tell
+    dos_file_position_t target = offset;
+    bool known = true;
+    if (origin == SEEK_CUR) {
+        known = stream->pos != DOS_STDIO_UNKNOWN;
+        target = stream->pos - unread(stream) + offset;
+        offset -= unread(stream);       // for DOS, which is ahead by the read-ahead
+    } else if (origin == SEEK_END) {
+        known = stream->length != DOS_STDIO_UNKNOWN;
+        target = stream->length + offset;
+    }
+    known = known && target >= 0;
+    if (known && seek_buffer(stream, target)) return 0;
+
+    stream->count = stream->next = stream->raw = 0;
+    if (known && target == stream->pos) return 0;
+    dos_error_code_t err = known ? seek_to(stream, target, SEEK_SET) : seek_to(stream, offset, (uint8_t)origin);
     if (err != DOS_SUCCESS) {
         errno = dos_to_errno(err);
         return -1;
     }
+    if (origin == SEEK_END) stream->length = stream->pos - offset;
     return 0;
 }
 
 long ftell(FILE* stream) {
-    if (!stream) {
+    if (!stream || !(stream->flags & DOS_STREAM_OPEN)) {
         errno = EBADF;
         return -1L;
     }
-    dos_file_position_t pos = 0;
-    dos_error_code_t err = dos_move_file_pointer(
-        (dos_file_handle_t)(uintptr_t)stream,
-        0,
-        SEEK_CUR,
-        &pos
-    );
-    if (err != DOS_SUCCESS) {
-        errno = dos_to_errno(err);
-        return -1L;
+    if (stream->pos == DOS_STDIO_UNKNOWN) {
+        dos_error_code_t err = seek_to(stream, 0, SEEK_CUR);
+        if (err != DOS_SUCCESS) {
+            errno = dos_to_errno(err);
+            return -1L;
+        }
     }
-    return (long)pos;
+    // DOS position adjusted by what is still in the buffer
+    if (stream->flags & DOS_STREAM_WRITING) return (long)stream->pos + stream->count + stream->newlines;
+    return (long)stream->pos - unread(stream);
+}
+
+int feof(FILE* stream) {
+    return (stream && (stream->flags & DOS_STREAM_EOF)) ? 1 : 0;
+}
+
+void clearerr(FILE* stream) {
+    if (stream) stream->flags &= ~DOS_STREAM_EOF;
 }
 
 #endif // USE_DOSLIBC_FILE_IO
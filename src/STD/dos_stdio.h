@@ -3,26 +3,64 @@
  * @brief Minimal C99 stdio implementation for DOS environments
  *
  * MEMORY SAVING DESIGN:
- * - Direct DOS interrupt calls avoid libc overhead
+ * - Direct DOS calls avoid libc overhead
  * - Macros for simple functions (putc, putchar) eliminate call overhead
- * - No buffering - direct character-by-character I/O
  * - Minimal error checking focused on essential cases
- * - Recursive printf helpers avoid large format string buffers
+ * - printf renders into a small stack buffer (DOS_STDIO_FORMAT_MAX), not a
+ *   per-call heap or static one: one write per call for short output
  * - uint16_t mode parsing in fopen avoids string processing
  *
- * FILE TYPE PUNNING:
- * - FILE is typedef'd as dos_file_handle_t (uint16_t)
- * - fopen returns (FILE*)handle - casting integer to pointer
- * - All functions cast back: (dos_file_handle_t)(uintptr_t)stream
- * - This maintains standard C FILE* interface while using simple integers
- * - stdin/stdout/stderr are handles 0,1,2 cast to FILE*
+ * STREAM BUFFERING:
+ * - FILE is a small stream object in a fixed table (dos_streams), no heap
+ * - Each stream has one buffer, used for output or read-ahead in turn;
+ *   a DOS call is made per buffer fill, not per character
+ * - File buffers (BUFSIZ) are allocated on first I/O, so setvbuf() can still
+ *   supply one; if allocation fails the stream runs unbuffered
+ * - stdout is line buffered from a static buffer, stderr is unbuffered,
+ *   reading stdin flushes stdout first (prompts appear before input)
+ * - Buffered output is flushed by fflush(), fclose() and exit(); returning
+ *   from main() leaves through the compiler's startup code, which does not
+ *   know these streams - end with exit() if the last line has no '\n'
+ *
+ * CONSOLE RAW MODE:
+ * - In cooked mode DOS checks Ctrl-C/Ctrl-S/Ctrl-P before every character
+ *   written to the console; in raw mode the driver gets the whole write
+ * - When stdout is a cooked character device, writes of DOS_STDIO_RAW_MIN
+ *   bytes or more switch it to raw mode (IOCTL 44h) and it stays raw for
+ *   the writes that follow, short ones included; a write holding a tab
+ *   switches back to cooked (only cooked mode expands tabs)
+ * - The mode belongs to the device, shared with stdin and stderr: it is
+ *   set back to cooked before stdin is read, before stderr is written, and
+ *   by exit() - a program killed in between leaves the console raw
+ *
+ * - dos_stdio_set_console() can take the console away from DOS altogether,
+ *   e.g. to a video memory writer; raw mode is then not needed
+ *
+ * TEXT AND BINARY STREAMS:
+ * - Streams are text unless opened with 'b'; stdin, stdout and stderr are text
+ * - Text output queues '\n' as is and keeps a byte free for each one; the
+ *   whole buffer is expanded to "\r\n" in place at flush, one DOS write
+ * - Text input collapses "\r\n" to '\n' over each refill, in the buffer;
+ *   bare '\n' line ends read as they are
+ * - The line ends in a read-ahead are all "\r\n" or all bare '\n', so the
+ *   file offset of every buffered byte is known: a refill stops at the first
+ *   line end of the other kind and keeps the bytes from there untranslated
+ *   for the next one (a file mixing both just refills more often)
+ * - Binary streams are byte exact; only they read or write around the buffer
+ * - A text buffer holds a whole "\r\n": setvbuf() refuses one of 1 byte
+ *
+ * FILE POSITION:
+ * - Each stream keeps the DOS file pointer (pos) and, once seen, the file
+ *   length; every read, write and seek of the stream updates them
+ * - ftell(), feof() and an fseek() landing inside the read-ahead make no
+ *   DOS call; other seeks go to DOS with an absolute offset
+ * - Only this stream may move its handle: a seek made on the handle
+ *   directly is not seen (the length is taken from end of file reads, so
+ *   a file grown by another handle keeps its old length until then)
  *
  * COMPROMISES:
- * - No file buffering (performance tradeoff)
  * - Limited format specifiers in printf
  * - No locale support
- * - Console-only \r\n conversion
- * - 16-bit file positions only
  */
 #ifndef DOS_STDIO_H
 #define DOS_STDIO_H
@@ -33,6 +71,7 @@
 
 #include "../DOS/dos_file_services.h"
 #include "dos_stddef.h"
+#include "dos_stdarg.h"
 
 #define EOF (-1)
 
@@ -41,13 +80,63 @@
 #define SEEK_END FSEEK_END
 
 #define DOS_STDIO_GETS_MAX  256
+#define DOS_STDIO_FORMAT_MAX 128   // fprintf renders into a stack buffer this size: one write per call
+#define DOS_STDIO_RAW_MIN   64      // console writes this long go out in raw mode
+
+#define BUFSIZ      2048        // default stream buffer: about 50 DOS writes per 100 KB
+#define FOPEN_MAX   20          // streams, stdin/stdout/stderr included (DOS default FILES=20)
+
+// setvbuf() modes
+#define _IOFBF      0           // full buffering: write when the buffer fills
+#define _IOLBF      1           // line buffering: write at each '\n' too
+#define _IONBF      2           // no buffering: write on every call
+
+// Stream flags
+#define DOS_STREAM_OPEN     0x01
+#define DOS_STREAM_READ     0x02    // opened for reading
+#define DOS_STREAM_WRITE    0x04    // opened for writing
+#define DOS_STREAM_TEXT     0x08    // text mode: '\n' is "\r\n" in the file
+#define DOS_STREAM_OWNBUF   0x10    // buffer allocated by the stream, freed on close
+#define DOS_STREAM_WRITING  0x20    // buffer holds output (else read-ahead)
+#define DOS_STREAM_CRLF     0x40    // text input: each '\n' in the buffer was "\r\n" in the file (else a bare '\n')
+#define DOS_STREAM_EOF      0x80    // a read hit end of file (feof), cleared by fseek()
+
+#define DOS_STDIO_UNKNOWN   (-1L)   // pos or length not known yet
+
+typedef struct {
+    dos_file_handle_t   handle;
+    uint8_t             flags;    // DOS_STREAM_*
+    uint8_t             mode;     // _IOFBF, _IOLBF or _IONBF
+    char*               buffer;   // NULL until first I/O unless set by setvbuf()
+    uint16_t            size;     // buffer size, 0 when unbuffered
+    uint16_t            count;    // output: bytes pending; input: bytes read ahead
+    uint16_t            next;     // input: next unread byte in the buffer
+    uint16_t            newlines; // text output: '\n' pending, each expands to "\r\n" at flush
+    uint16_t            raw;      // text input: file bytes after buffer[count] not translated yet
+    dos_file_position_t pos;      // DOS file pointer, behind the buffer (or DOS_STDIO_UNKNOWN)
+    dos_file_position_t length;   // file length once known (or DOS_STDIO_UNKNOWN)
+} FILE;
+
+extern FILE dos_streams[FOPEN_MAX];
+
+#define stdin  (&dos_streams[0])
+#define stdout (&dos_streams[1])
+#define stderr (&dos_streams[2])
+
+// buffering
+int setvbuf(FILE* stream, char* buf, int mode, size_t size);
+#define setbuf(stream, buf) setvbuf((stream), (buf), (buf) ? _IOFBF : _IONBF, BUFSIZ)
+int fflush(FILE* stream);       // NULL: every output stream
+
+// Console output through a writer instead of DOS (e.g. bios_console_write on video memory)
+typedef void (*dos_console_write_t)(void* ctx, const char* s, uint16_t n);
 
-typedef dos_file_handle_t FILE;
-
-// C type punning
-#define stdin  ((FILE*)(uintptr_t)0)
-#define stdout ((FILE*)(uintptr_t)1)
-#define stderr ((FILE*)(uintptr_t)2)
+/**
+ * @brief Send what stdout and stderr write (after "\r\n" translation) to write(ctx, ...)
+ * @param write NULL to go back to DOS
+ * @return 0, or EOF with errno ENODEV if stdout is not the console (redirected output stays with DOS)
+ */
+int dos_stdio_set_console(dos_console_write_t write, void* ctx);
 
 // character output
 int fputc(int c, FILE* stream);
@@ -58,10 +147,18 @@ int fputc(int c, FILE* stream);
 int fputs(const char* str, FILE* stream);
 #define puts(str) (fputs(str, stdout), fputc('\n', stdout))
 
-// formatted output - fprintf is core, printf is macro
+// formatted output - vfprintf/vsnprintf share one core, printf is macro
+int vfprintf(FILE* stream, const char* format, va_list args);
 int fprintf(FILE* stream, const char* format, ...);
+#define vprintf(fmt, args) vfprintf(stdout, (fmt), (args))
 #define printf(fmt, ...) fprintf(stdout, fmt, ##__VA_ARGS__)
 
+// formatted output to memory - no DOS calls; returns the full length even when truncated
+int vsnprintf(char* s, size_t n, const char* format, va_list args);
+int snprintf(char* s, size_t n, const char* format, ...);
+int vsprintf(char* s, const char* format, va_list args);
+int sprintf(char* s, const char* format, ...);
+
 // character input
 int fgetc(FILE* stream);
 #define getc(stream) fgetc(stream)
@@ -71,9 +168,22 @@ int fgetc(FILE* stream);
 char* fgets(char* s, int size, FILE* stream);
 #define gets(s) fgets((s), DOS_STDIO_GETS_MAX, stdin)
 
-// formatted input
+/**
+ * Zero-copy line read (BSD fgetln): returns the next line in the stream
+ * buffer, '\n' included if present, not terminated; *len is its length.
+ * Valid until the next operation on the stream. A line straddling a refill
+ * is moved to the front of the buffer first; one longer than the buffer
+ * comes back in buffer-sized pieces (no '\n' at the end of a piece).
+ * NULL at end of file, on error, or on an unbuffered stream (EINVAL).
+ */
+char* fgetln(FILE* stream, size_t* len);
+
+// formatted input - SNO primitives over the read-ahead (fscanf) or the string (sscanf)
+int vfscanf(FILE* stream, const char* format, va_list args);
 int fscanf(FILE* stream, const char* format, ...);
 #define scanf(fmt, ...) fscanf(stdin, fmt, ##__VA_ARGS__)
+int vsscanf(const char* str, const char* format, va_list args);
+int sscanf(const char* str, const char* format, ...);
 
 // error output
 void perror(const char *s);
@@ -86,6 +196,8 @@ size_t fread(void* ptr, size_t size, size_t count, FILE* stream);
 size_t fwrite(const void* ptr, size_t size, size_t count, FILE* stream);
 int fseek(FILE* stream, long offset, int origin);
 long ftell(FILE* stream);
+int feof(FILE* stream);
+void clearerr(FILE* stream);
 int fclose(FILE* stream);
 
 #endif // USE_DOSLIBC_FILE_IO
@@ -44,3 +44,17 @@ void* dos_calloc(size_t n, size_t size) {         // overflow
     }
     return NULL;
 }
+
+static void (*atexit_funcs[DOS_ATEXIT_MAX])(void);
+static uint8_t atexit_count = 0;
+
+int dos_atexit(void (*func)(void)) {
+    if (!func || atexit_count == DOS_ATEXIT_MAX) return -1;
+    atexit_funcs[atexit_count++] = func;
+    return 0;
+}
+
+void dos_exit(int status) {
+    while (atexit_count > 0) atexit_funcs[--atexit_count]();   // a function may call exit() again
+    dos_terminate_process_with_return_code((uint8_t)status);
+}
@@ -8,11 +8,17 @@ void* dos_malloc(size_t size);
 void dos_free(void* p);
 void* dos_calloc(size_t n, size_t size);
 
+#define DOS_ATEXIT_MAX  32      // C99 minimum
+
+int dos_atexit(void (*func)(void));     // 0 if registered
+void dos_exit(int status);              // runs atexit functions (last first), then terminates
+
 #ifdef POLICY_USE_DOSLIBC
     #define malloc  dos_malloc
     #define free    dos_free
     #define calloc  dos_calloc
-    #define exit(status) dos_terminate_process_with_return_code(status)
+    #define atexit  dos_atexit
+    #define exit(status) dos_exit(status)
 #endif
 
 #endif
@@ -0,0 +1,92 @@
+#ifndef TEST_BIOS_VIDEO_H
+#define TEST_BIOS_VIDEO_H
+
+#ifdef USE_DOSLIBC
+    #include "../STD/dos_stdio.h"
+    #include "../STD/dos_string.h"
+    #include "../STD/dos_assert.h"
+#else
+    #include <stdio.h>
+    #include <string.h>
+    #include <assert.h>
+#endif
+
+#include "../BIOS/bios_video_console.h"
+
+#define TEST_VIDEO_ROWS 25
+#define TEST_VIDEO_COLS 80
+
+static uint16_t test_screen[TEST_VIDEO_ROWS * TEST_VIDEO_COLS];     // stub framebuffer
+static uint16_t test_screen_copy[TEST_VIDEO_ROWS * TEST_VIDEO_COLS];
+
+// Characters of a row, trailing blanks dropped
+static const char* test_video_row(const bios_console_t* c, uint8_t row) {
+    static char text[TEST_VIDEO_COLS + 1];
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < c->cols; i++) {
+        text[i] = (char)(c->cells[(uint16_t)row * c->cols + i] & 0xFF);
+        if (text[i] != ' ') n = i + 1;
+    }
+    text[n] = '\0';
+    return text;
+}
+
+void test_bios_console_write(void) {
+    bios_console_t c;
+    char line[16];
+
+    bios_console_init(&c, test_screen, TEST_VIDEO_ROWS, TEST_VIDEO_COLS, 0x07);
+    bios_console_clear(&c);
+    assert(test_screen[0] == 0x0720 && c.row == 0 && c.col == 0);
+
+    // Character/attribute words, CR and LF
+    bios_console_write(&c, "Hello\r\nWorld", 12);
+    assert(strcmp(test_video_row(&c, 0), "Hello") == 0 && strcmp(test_video_row(&c, 1), "World") == 0);
+    assert(test_screen[0] == 0x0748 && c.row == 1 && c.col == 5);
+
+    // BS, TAB and BEL
+    bios_console_write(&c, "\r\nab\bc\td\a", 9);
+    assert(strcmp(test_video_row(&c, 2), "ac      d") == 0 && c.col == 9);
+
+    // Wrap at the right edge
+    bios_console_write(&c, "\r\n", 2);
+    for (int i = 0; i < 85; i++) bios_console_write(&c, "x", 1);
+    assert(strlen(test_video_row(&c, 3)) == 80 && strcmp(test_video_row(&c, 4), "xxxxx") == 0);
+    assert(c.row == 4 && c.col == 5);
+
+    // Scrolling one line at a time...
+    for (int i = 0; i < 100; i++) {
+        int n = sprintf(line, "\r\nline %d", i);
+        bios_console_write(&c, line, (uint16_t)n);
+    }
+    assert(c.row == 24 && strcmp(test_video_row(&c, 24), "line 99") == 0);
+    assert(strcmp(test_video_row(&c, 0), "line 75") == 0);
+    memcpy(test_screen_copy, test_screen, sizeof(test_screen));
+
+    // ...and many lines in one write (scrolled in blocks) leave the same screen
+    static char text[1200];
+    int len = 0;
+    bios_console_clear(&c);
+    len = sprintf(text, "Hello\r\nWorld\r\nac      d\r\n");
+    for (int i = 0; i < 85; i++) text[len++] = 'x';
+    for (int i = 0; i < 100; i++) len += sprintf(text + len, "\r\nline %d", i);
+    bios_console_write(&c, text, (uint16_t)len);
+    assert(memcmp(test_screen, test_screen_copy, sizeof(test_screen)) == 0);
+
+    // Redraw a row in place: padded to the full width, cursor kept
+    bios_console_line(&c, 5, "redrawn", 7, 0x1F);
+    assert(strcmp(test_video_row(&c, 5), "redrawn") == 0);
+    assert(test_screen[5 * TEST_VIDEO_COLS] == 0x1F72 && test_screen[6 * TEST_VIDEO_COLS - 1] == 0x1F20);
+    assert(c.row == 24 && c.col == 7);
+
+    bios_console_goto(&c, 30, 90);
+    assert(c.row == 24 && c.col == 79);
+
+    printf("Video console tests passed\n\n");
+}
+
+void test_bios_video(void) {
+    test_bios_console_write();
+}
+
+#endif
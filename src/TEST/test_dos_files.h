@@ -362,6 +362,26 @@ void test_dos_files() {
     assert(dos_file_ext(NULL) == NULL);
     printf("NULL -> NULL\n");
 
+    printf("18. Testing device information...\n");
+    uint16_t info = 0;
+    err = dos_create_file("DEVINFO.TXT", CREATE_READ_WRITE, &fh);
+    assert(err == 0);
+    assert(dos_get_device_info(fh, &info) == 0);
+    assert(!(info & DOS_DEV_CHAR));                 // a disk file
+    dos_close_file(fh);
+    dos_delete_file("DEVINFO.TXT");
+    assert(dos_get_device_info(0xFFFF, &info) != 0);
+
+    assert(dos_get_device_info(1, &info) == 0);
+    if (info & DOS_DEV_CHAR) {                      // stdout not redirected
+        uint16_t mode = 0;
+        assert(dos_set_device_info(1, info | DOS_DEV_BINARY) == 0);
+        assert(dos_get_device_info(1, &mode) == 0 && (mode & DOS_DEV_BINARY));
+        assert(dos_set_device_info(1, info) == 0);
+        assert(dos_get_device_info(1, &mode) == 0 && (mode & DOS_DEV_BINARY) == (info & DOS_DEV_BINARY));
+        printf("Console raw/cooked switch working (device word 0x%04X)\n", info);
+    }
+
     printf("ALL TESTS PASSED\n");
 }
 
@@ -535,6 +535,349 @@ void test_file_operations_integration(void) {
     printf("File operations (integration) tests passed\n\n");
 }
 
+void test_setvbuf_fflush(void) {
+    const char* test_file = "buffer.txt";
+    FILE* f = NULL;
+    char own[8];
+    char buf[64];
+
+    test_file_cleanup(test_file);
+
+    // Buffered output reaches the file only on fflush
+    f = fopen(test_file, "w");
+    assert(f != NULL);
+    fputs("pending", f);
+    assert(test_file_readall(test_file, buf, sizeof(buf)) == 0);
+    assert(fflush(f) == 0);
+    assert(test_file_readall(test_file, buf, sizeof(buf)) == 7);
+    assert(strcmp(buf, "pending") == 0);
+    fclose(f);
+
+    // Line buffering with a caller buffer: written at each newline
+    f = fopen(test_file, "wb");
+    assert(f != NULL);
+    assert(setvbuf(f, own, _IOLBF, sizeof(own)) == 0);
+    fputs("ab", f);
+    assert(test_file_readall(test_file, buf, sizeof(buf)) == 0);
+    fputs("c\nd", f);
+    assert(test_file_readall(test_file, buf, sizeof(buf)) == 5);
+    fputs("0123456789", f);     // longer than the buffer
+    fclose(f);
+    assert(test_file_readall(test_file, buf, sizeof(buf)) == 15);
+    assert(strcmp(buf, "abc\nd0123456789") == 0);
+
+    // Unbuffered: written at once
+    f = fopen(test_file, "w");
+    assert(f != NULL);
+    assert(setvbuf(f, NULL, _IONBF, 0) == 0);
+    fputc('z', f);
+    assert(test_file_readall(test_file, buf, sizeof(buf)) == 1);
+    assert(setvbuf(f, NULL, 3, 0) != 0);
+    fclose(f);
+
+    // A text buffer must hold a "\r\n": 1 byte is refused, 2 collapse every line end
+    f = fopen(test_file, "wb");
+    assert(f != NULL);
+    fputs("a\r\nb\r\n", f);
+    fclose(f);
+    f = fopen(test_file, "r");
+    assert(f != NULL);
+    errno = 0;
+    assert(setvbuf(f, own, _IOFBF, 1) == EOF && errno == EINVAL);
+    assert(setvbuf(f, own, _IOFBF, 2) == 0);
+    assert(fgetc(f) == 'a' && fgetc(f) == '\n' && fgetc(f) == 'b' && fgetc(f) == '\n' && fgetc(f) == EOF);
+    fclose(f);
+    f = fopen(test_file, "rb");
+    assert(f != NULL);
+    assert(setvbuf(f, own, _IOFBF, 1) == 0);      // binary: any size
+    assert(fgetc(f) == 'a' && fgetc(f) == '\r');
+    fclose(f);
+
+    // Read after write on an update stream sees the buffered data
+    f = fopen(test_file, "w+");
+    assert(f != NULL);
+    fputs("0123456789", f);
+    assert(ftell(f) == 10);
+    fseek(f, 2, SEEK_SET);
+    assert(fgetc(f) == '2');
+    fputc('X', f);
+    fseek(f, 0, SEEK_SET);
+    assert(fgets(buf, sizeof(buf), f) != NULL);
+    assert(strcmp(buf, "012X456789") == 0);
+    fclose(f);
+
+    test_file_cleanup(test_file);
+    printf("setvbuf() / fflush() tests passed\n\n");
+}
+
+void test_fgetln(void) {
+    const char* test_file = "fgetln.txt";
+    FILE* f = NULL;
+    char small[8];
+    char* line = NULL;
+    size_t len = 0;
+
+    test_file_cleanup(test_file);
+    f = fopen(test_file, "w");
+    assert(f != NULL);
+    fputs("one\ntwo\nthree and more\nlast", f);
+    fclose(f);
+
+    // Lines point into the stream buffer, '\n' included
+    f = fopen(test_file, "r");
+    assert(f != NULL);
+    line = fgetln(f, &len);
+    assert(line != NULL && len == 4 && memcmp(line, "one\n", 4) == 0);
+    assert(fgetc(f) == 't');
+    line = fgetln(f, &len);
+    assert(line != NULL && len == 3 && memcmp(line, "wo\n", 3) == 0);
+    line = fgetln(f, &len);
+    assert(line != NULL && len == 15 && memcmp(line, "three and more\n", 15) == 0);
+    line = fgetln(f, &len);
+    assert(line != NULL && len == 4 && memcmp(line, "last", 4) == 0);
+    assert(fgetln(f, &len) == NULL);
+    fclose(f);
+
+    // A line longer than the buffer comes back in buffer-sized pieces
+    f = fopen(test_file, "r");
+    assert(f != NULL);
+    assert(setvbuf(f, small, _IOFBF, sizeof(small)) == 0);
+    line = fgetln(f, &len);
+    assert(line != NULL && len == 4);
+    line = fgetln(f, &len);     // "two\n" straddles the first refill
+    assert(line != NULL && len == 4 && memcmp(line, "two\n", 4) == 0);
+    line = fgetln(f, &len);
+    assert(line != NULL && len == 8 && memcmp(line, "three an", 8) == 0);
+    line = fgetln(f, &len);
+    assert(line != NULL && len == 7 && memcmp(line, "d more\n", 7) == 0);
+    fclose(f);
+
+    test_file_cleanup(test_file);
+    printf("fgetln() tests passed\n\n");
+}
+
+void test_fscanf_sscanf(void) {
+    const char* test_file = "fscanf.txt";
+    FILE* f = NULL;
+    char small[8];
+    char word[16];
+    char rest[16];
+    int a = 0, b = 0, n = 0;
+    unsigned int u = 0;
+    long l = 0;
+
+    // sscanf: conversions, widths, scansets, %n and failures
+    assert(sscanf("  12 -34", "%d%d", &a, &b) == 2 && a == 12 && b == -34);
+    assert(sscanf("123456", "%3d%d", &a, &b) == 2 && a == 123 && b == 456);
+    assert(sscanf("-70000 ff 0x1F 017", "%ld %x %i %o", &l, &u, &a, &b) == 4);
+    assert(l == -70000L && u == 0xFF && a == 31 && b == 15);
+    assert(sscanf("key=value;", "%[a-z]=%[^;];%n", word, rest, &n) == 2);
+    assert(strcmp(word, "key") == 0 && strcmp(rest, "value") == 0 && n == 10);
+    assert(sscanf("10 20", "%*d %d", &a) == 1 && a == 20);
+    assert(sscanf("x=5; y=7", "x=%d, y=%d", &a, &b) == 1 && a == 5);
+    assert(sscanf("abc", "%d", &a) == 0);
+    assert(sscanf("   ", "%d", &a) == EOF);
+    assert(sscanf("+", "%2c", word) == EOF && sscanf("5+", "%d%2c", &a, word) == 1);
+    assert(sscanf("+-", "%2c", word) == 1 && memcmp(word, "+-", 2) == 0);
+
+    test_file_cleanup(test_file);
+    f = fopen(test_file, "w");
+    assert(f != NULL);
+    fputs("point 10 20\npoint 300 4000\nname hello\n", f);
+    fclose(f);
+
+    // fscanf: fields straddle refills of a small buffer, the position is kept for other reads
+    f = fopen(test_file, "r");
+    assert(f != NULL);
+    assert(setvbuf(f, small, _IOFBF, sizeof(small)) == 0);
+    assert(fscanf(f, "point %d %d", &a, &b) == 2 && a == 10 && b == 20);
+    assert(fscanf(f, " point %d %d", &a, &b) == 2 && a == 300 && b == 4000);
+    assert(fscanf(f, " name %5s", word) == 1 && strcmp(word, "hello") == 0);
+    assert(fgetc(f) == '\n');
+    assert(fscanf(f, "%d", &a) == EOF);
+    fclose(f);
+
+    // %[ and %c fields run on over line ends, and over refills
+    f = fopen(test_file, "w");
+    assert(f != NULL);
+    fputs("x\ny\nzz;\nab\ncd\n", f);
+    fclose(f);
+    f = fopen(test_file, "r");
+    assert(f != NULL);
+    assert(setvbuf(f, small, _IOFBF, sizeof(small)) == 0);
+    assert(fscanf(f, "%[^;];", rest) == 1 && strcmp(rest, "x\ny\nzz") == 0);
+    assert(fscanf(f, " %4c", word) == 1 && memcmp(word, "ab\nc", 4) == 0);
+    assert(fscanf(f, "%2c", word) == 1 && memcmp(word, "d\n", 2) == 0);
+    assert(fscanf(f, "%c", word) == EOF);
+    fclose(f);
+
+    test_file_cleanup(test_file);
+    printf("fscanf()/sscanf() tests passed\n\n");
+}
+
+void test_text_binary(void) {
+    const char* test_file = "text.txt";
+    FILE* f = NULL;
+    char small[4];
+    char buf[64];
+
+    test_file_cleanup(test_file);
+
+    // Text output: '\n' is "\r\n" in the file, ftell counts file bytes
+    f = fopen(test_file, "w");
+    assert(f != NULL);
+    fputs("ab\ncd\n", f);
+    fputc('\n', f);
+    assert(ftell(f) == 10);
+    fclose(f);
+    assert(test_file_readall(test_file, buf, sizeof(buf)) == 10);
+    assert(strcmp(buf, "ab\r\ncd\r\n\r\n") == 0);
+
+    // Text input collapses it again, also when "\r\n" straddles a refill
+    f = fopen(test_file, "r");
+    assert(f != NULL);
+    assert(setvbuf(f, small, _IOFBF, sizeof(small)) == 0);
+    assert(fgets(buf, sizeof(buf), f) != NULL && strcmp(buf, "ab\n") == 0);
+    assert(ftell(f) == 4);
+    assert(fgets(buf, sizeof(buf), f) != NULL && strcmp(buf, "cd\n") == 0);
+    assert(fgetc(f) == '\n' && fgetc(f) == EOF);
+    fclose(f);
+
+    // Binary streams are byte exact both ways
+    f = fopen(test_file, "rb");
+    assert(f != NULL);
+    assert(fread(buf, 1, sizeof(buf), f) == 10 && memcmp(buf, "ab\r\ncd", 6) == 0);
+    fclose(f);
+    f = fopen(test_file, "wb");
+    assert(f != NULL);
+    fputs("x\ny\rz\r\n", f);
+    fclose(f);
+    assert(test_file_readall(test_file, buf, sizeof(buf)) == 7);
+
+    // Bare '\n' and lone '\r' read as they are
+    f = fopen(test_file, "r");
+    assert(f != NULL);
+    assert(fgets(buf, sizeof(buf), f) != NULL && strcmp(buf, "x\n") == 0);
+    assert(fgets(buf, sizeof(buf), f) != NULL && strcmp(buf, "y\rz\n") == 0);
+    fclose(f);
+
+    // Positions stay exact over bare '\n' lines, and over both kinds in one buffer
+    f = fopen(test_file, "wb");
+    assert(f != NULL);
+    fputs("ab\ncd\nef\n", f);
+    fclose(f);
+    f = fopen(test_file, "r");
+    assert(f != NULL);
+    assert(fgetc(f) == 'a' && fgetc(f) == 'b' && ftell(f) == 2);
+    assert(fseek(f, -1, SEEK_CUR) == 0 && fgetc(f) == 'b');
+    assert(fread(buf, 1, sizeof(buf), f) == 7 && memcmp(buf, "\ncd\nef\n", 7) == 0);
+    fclose(f);
+    f = fopen(test_file, "wb");
+    assert(f != NULL);
+    fputs("a\r\nb\nc\r\nd\n", f);
+    fclose(f);
+    f = fopen(test_file, "r");
+    assert(f != NULL);
+    assert(fgets(buf, sizeof(buf), f) != NULL && strcmp(buf, "a\n") == 0 && ftell(f) == 3);
+    assert(fgets(buf, sizeof(buf), f) != NULL && strcmp(buf, "b\n") == 0 && ftell(f) == 5);
+    assert(fgets(buf, sizeof(buf), f) != NULL && strcmp(buf, "c\n") == 0 && ftell(f) == 8);
+    assert(fflush(f) == 0 && fgets(buf, sizeof(buf), f) != NULL && strcmp(buf, "d\n") == 0);
+    assert(fgetc(f) == EOF && ftell(f) == 10);
+    fclose(f);
+
+    test_file_cleanup(test_file);
+    printf("Text / binary mode tests passed\n\n");
+}
+
+void test_file_position(void) {
+    const char* test_file = "pos.txt";
+    FILE* f = NULL;
+    char buf[64];
+    long at[5];
+
+    test_file_cleanup(test_file);
+
+    f = fopen(test_file, "w");
+    assert(f != NULL);
+    for (int i = 0; i < 5; i++) fprintf(f, "record %d\n", i);
+    assert(ftell(f) == 50);
+    assert(fseek(f, 0, SEEK_CUR) == 0 && ftell(f) == 50);
+    fclose(f);
+
+    // ftell per record, then back to each one: the seeks land in the read-ahead
+    f = fopen(test_file, "r");
+    assert(f != NULL);
+    for (int i = 0; i < 5; i++) {
+        at[i] = ftell(f);
+        assert(at[i] == 10L * i);
+        assert(fgets(buf, sizeof(buf), f) != NULL);
+    }
+    assert(!feof(f));
+    assert(fgetc(f) == EOF && feof(f));
+    for (int i = 4; i >= 0; i--) {
+        assert(fseek(f, at[i], SEEK_SET) == 0 && !feof(f));
+        assert(fgets(buf, sizeof(buf), f) != NULL && buf[7] == '0' + i);
+    }
+    assert(fseek(f, -10, SEEK_END) == 0 && ftell(f) == 40);
+    assert(fgets(buf, sizeof(buf), f) != NULL && strcmp(buf, "record 4\n") == 0);
+    assert(fseek(f, 9, SEEK_SET) == 0 && fgetc(f) == '\n');  // the middle of "\r\n" goes to DOS
+    assert(fseek(f, -8, SEEK_CUR) == 0 && ftell(f) == 2 && fgetc(f) == 'c');
+    clearerr(f);
+    fclose(f);
+
+    // Append starts at the end; the end moves with the writes
+    f = fopen(test_file, "ab");
+    assert(f != NULL);
+    assert(ftell(f) == 50);
+    fputs("tail", f);
+    assert(fseek(f, 0, SEEK_END) == 0 && ftell(f) == 54);
+    fclose(f);
+
+    // The same index over bare '\n' records, with a buffer a few records long
+    f = fopen(test_file, "wb");
+    assert(f != NULL);
+    for (int i = 0; i < 100; i++) fprintf(f, i % 10 ? "record %03d\n" : "record %03d\r\n", i);
+    fclose(f);
+    {
+        static long index[100];
+        char small[32];
+        int n = -1;
+        f = fopen(test_file, "r");
+        assert(f != NULL);
+        assert(setvbuf(f, small, _IOFBF, sizeof(small)) == 0);
+        for (int i = 0; i < 100; i++) {
+            index[i] = ftell(f);
+            assert(fgets(buf, sizeof(buf), f) != NULL && sscanf(buf, "record %d", &n) == 1 && n == i);
+        }
+        assert(ftell(f) == 100L * 11 + 10);
+        for (int i = 99; i >= 0; i -= 7) {
+            assert(fseek(f, index[i], SEEK_SET) == 0 && ftell(f) == index[i]);
+            assert(fgets(buf, sizeof(buf), f) != NULL && sscanf(buf, "record %d", &n) == 1 && n == i);
+        }
+        fclose(f);
+    }
+
+    // A read around the buffer leaves no stale read-ahead for a seek to land in
+    f = fopen(test_file, "wb");
+    assert(f != NULL);
+    for (int i = 0; i < 100; i++) fputc(i, f);
+    fclose(f);
+    {
+        char small[16];
+        f = fopen(test_file, "rb");
+        assert(f != NULL);
+        assert(setvbuf(f, small, _IOFBF, sizeof(small)) == 0);
+        for (int i = 0; i < 16; i++) assert(fgetc(f) == i);
+        assert(fread(buf, 1, 32, f) == 32 && buf[0] == 16 && buf[31] == 47);
+        assert(fseek(f, 40, SEEK_SET) == 0 && fgetc(f) == 40 && ftell(f) == 41);
+        assert(fseek(f, 8, SEEK_SET) == 0 && fgetc(f) == 8);
+        fclose(f);
+    }
+
+    test_file_cleanup(test_file);
+    printf("File position tests passed\n\n");
+}
+
 void test_files(void) {
 
     test_fopen();
@@ -546,6 +889,11 @@ void test_files(void) {
     test_fclose();
     test_fgets_file();
     test_file_operations_integration();
+    test_setvbuf_fflush();
+    test_fgetln();
+    test_fscanf_sscanf();
+    test_text_binary();
+    test_file_position();
 
 }
 
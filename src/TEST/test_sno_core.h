@@ -342,6 +342,194 @@ void test_num(void) {
     assert(!num(&sub, &n) && !sub.begin && sub.end == buf2);
 }
 
+void test_real(void) {
+    view_t sub;
+    double x;
+
+    // Exactly representable values
+    sub = bind("3.25");
+    assert(real(&sub, &x) && x == 3.25 && sub.begin == sub.end);
+
+    sub = bind("-0.5");
+    assert(real(&sub, &x) && x == -0.5 && sub.begin == sub.end);
+
+    sub = bind("+42");
+    assert(real(&sub, &x) && x == 42.0 && sub.begin == sub.end);
+
+    sub = bind("1.25e2");
+    assert(real(&sub, &x) && x == 125.0 && sub.begin == sub.end);
+
+    sub = bind("2E-1");
+    assert(real(&sub, &x) && x > 0.19999 && x < 0.20001 && sub.begin == sub.end);
+
+    // Leading or trailing point
+    sub = bind(".5");
+    assert(real(&sub, &x) && x == 0.5 && sub.begin == sub.end);
+
+    sub = bind("7.");
+    assert(real(&sub, &x) && x == 7.0 && sub.begin == sub.end);
+
+    // Telemetry style: stop at first non-number char
+    sub = bind("98.6F");
+    assert(real(&sub, &x) && x > 98.59 && x < 98.61 && *sub.begin == 'F');
+
+    sub = bind("1.5,2.5");
+    assert(real(&sub, &x) && x == 1.5 && chr(&sub, ',') && real(&sub, &x) && x == 2.5);
+
+    // Exponent marker without digits is not consumed
+    sub = bind("2e");
+    assert(real(&sub, &x) && x == 2.0 && *sub.begin == 'e');
+
+    sub = bind("2e+x");
+    assert(real(&sub, &x) && x == 2.0 && *sub.begin == 'e');
+
+    // Large and small magnitudes
+    sub = bind("1e300");
+    assert(real(&sub, &x) && x > 0.99e300 && x < 1.01e300 && sub.begin == sub.end);
+
+    sub = bind("1e-300");
+    assert(real(&sub, &x) && x > 0.99e-300 && x < 1.01e-300 && sub.begin == sub.end);
+
+    sub = bind("123456789012345678901234567890");
+    assert(real(&sub, &x) && x > 1.2345e29 && x < 1.2346e29 && sub.begin == sub.end);
+
+    sub = bind("0.000000000000000000000000000001");
+    assert(real(&sub, &x) && x > 0.99e-30 && x < 1.01e-30 && sub.begin == sub.end);
+
+#ifndef POLICY_USE_DOSLIBC
+    // Host path is correctly rounded
+    sub = bind("0.1");
+    assert(real(&sub, &x) && x == 0.1);
+
+    sub = bind("2.2250738585072014e-308");
+    assert(real(&sub, &x) && x == 2.2250738585072014e-308);
+
+    sub = bind("9007199254740993");    // 2^53 + 1: halfway, rounds to even
+    assert(real(&sub, &x) && x == 9007199254740992.0);
+
+    {
+        // Past the copy buffer: the digits still count, a far nonzero one lifts the halfway case
+        static char longer[256];
+        memset(longer, '0', sizeof longer - 1);
+        memcpy(longer, "9007199254740993.", 17);
+        longer[sizeof longer - 2] = '1';
+        sub = bind(longer);
+        assert(real(&sub, &x) && x == 9007199254740994.0 && sub.begin == sub.end);
+        longer[sizeof longer - 2] = '0';
+        sub = bind(longer);
+        assert(real(&sub, &x) && x == 9007199254740992.0);
+        memset(longer, '0', 200);
+        memcpy(longer, "0.", 2);                        // 198 zeros after the point
+        memcpy(longer + 200, "9007199254740993e214", 21);
+        sub = bind(longer);
+        assert(real(&sub, &x) && x == 9007199254740992.0 && sub.begin == sub.end);
+    }
+#endif
+
+    // Failure: no mantissa digits, cursor unchanged
+    char buf[] = "-.e5";
+    sub = bind(buf);
+    cursor_t orig = sub.begin;
+    assert(!real(&sub, &x) && sub.begin == orig);
+
+    sub = bind(".");
+    assert(!real(&sub, &x));
+
+    sub = bind("+");
+    assert(!real(&sub, &x));
+
+    sub = bind("e5");
+    assert(!real(&sub, &x));
+
+    sub = bind("");
+    assert(!real(&sub, &x));
+
+    // NULL safety
+    assert(!real(NULL, &x));
+    sub = bind("1.0");
+    assert(!real(&sub, NULL) && sub.begin != sub.end);
+    sub = view(NULL, NULL);
+    assert(!real(&sub, &x));
+}
+
+void test_hexnum(void) {
+    view_t sub;
+    unsigned long n;
+
+    sub = bind("1A3F");
+    assert(hexnum(&sub, &n) && n == 0x1A3FUL && sub.begin == sub.end);
+
+    sub = bind("deadBEEF");
+    assert(hexnum(&sub, &n) && n == 0xDEADBEEFUL && sub.begin == sub.end);
+
+    sub = bind("0");
+    assert(hexnum(&sub, &n) && n == 0 && sub.begin == sub.end);
+
+    // Composition with prefix
+    sub = bind("0xFF;");
+    assert(str(&sub, "0x") && hexnum(&sub, &n) && n == 255 && *sub.begin == ';');
+
+    // Stop at first non-hex digit
+    sub = bind("abcg");
+    assert(hexnum(&sub, &n) && n == 0xABC && *sub.begin == 'g');
+
+    // Failure: no digits, cursor unchanged
+    char buf[] = "xyz";
+    sub = bind(buf);
+    cursor_t orig = sub.begin;
+    assert(!hexnum(&sub, &n) && sub.begin == orig);
+
+    sub = bind("-1");
+    assert(!hexnum(&sub, &n));
+
+    sub = bind("");
+    assert(!hexnum(&sub, &n));
+
+    // Failure: overflow, cursor unchanged
+    char big[] = "1FFFFFFFFFFFFFFFFF";
+    sub = bind(big);
+    orig = sub.begin;
+    assert(!hexnum(&sub, &n) && sub.begin == orig);
+
+    // NULL safety
+    assert(!hexnum(NULL, &n));
+    sub = bind("1");
+    assert(!hexnum(&sub, NULL));
+    sub = view(NULL, NULL);
+    assert(!hexnum(&sub, &n));
+}
+
+void test_octnum(void) {
+    view_t sub;
+    unsigned long n;
+
+    sub = bind("755");
+    assert(octnum(&sub, &n) && n == 0755 && sub.begin == sub.end);
+
+    sub = bind("0");
+    assert(octnum(&sub, &n) && n == 0 && sub.begin == sub.end);
+
+    // Stop at first non-octal digit
+    sub = bind("178");
+    assert(octnum(&sub, &n) && n == 017 && *sub.begin == '8');
+
+    // Failure: no digits, cursor unchanged
+    char buf[] = "9";
+    sub = bind(buf);
+    cursor_t orig = sub.begin;
+    assert(!octnum(&sub, &n) && sub.begin == orig);
+
+    // Failure: overflow
+    sub = bind("7777777777777777777777777");
+    orig = sub.begin;
+    assert(!octnum(&sub, &n) && sub.begin == orig);
+
+    // NULL safety
+    assert(!octnum(NULL, &n));
+    sub = view(NULL, NULL);
+    assert(!octnum(&sub, &n));
+}
+
 void test_nul(void) {
     view_t sub;
     cursor_t orig;
@@ -1059,6 +1247,9 @@ void test_sno_core(void) {
     // 2.5
     test_var();
     test_num();
+    test_real();
+    test_hexnum();
+    test_octnum();
     // 2.6
     test_nul();
     // 2.7
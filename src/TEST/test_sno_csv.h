@@ -0,0 +1,121 @@
+/**
+ * @file test_sno_csv.h
+ * @brief Tests for SNOBOL4-C CSV/TSV record parser
+ *
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file
+ */
+#ifndef TEST_SNO_CSV_H
+#define TEST_SNO_CSV_H
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_csv.h"
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+
+static bool test_field_is(view_t field, const char* text) {
+    return field.begin && size(field) == strlen(text) && memcmp(field.begin, text, strlen(text)) == 0;
+}
+
+void test_sno_csv_rows(void) {
+    static const char text[] =
+        "id,name,comment\r\n"
+        "1,alpha,plain text longer than one word\n"
+        "2,\"beta, gamma\",\"say \"\"hi\"\"\"\n"
+        "3,,\"multi\nline\"\n"
+        "\n"
+        "4,last";
+    static char scratch[64];
+    sno_csv_t csv;
+    sno_csv_row_t row;
+
+    assert(sno_csv_init(&csv, bind(text), ',', SNO_CSV_ALL, scratch, sizeof scratch));
+    assert(sno_csv_next(&csv, &row) && row.count == 3);
+    assert(test_field_is(row.fields[0], "id") && test_field_is(row.fields[2], "comment"));
+
+    assert(sno_csv_next(&csv, &row) && row.count == 3);
+    assert(test_field_is(row.fields[2], "plain text longer than one word"));
+
+    // Quoted separator stays in the input, escaped quote is unescaped into scratch
+    assert(sno_csv_next(&csv, &row) && row.count == 3);
+    assert(test_field_is(row.fields[1], "beta, gamma"));
+    assert(row.fields[1].begin > text && row.fields[1].begin < text + sizeof text);
+    assert(test_field_is(row.fields[2], "say \"hi\"") && row.fields[2].begin == scratch);
+
+    assert(sno_csv_next(&csv, &row) && row.count == 3);
+    assert(test_field_is(row.fields[1], "") && test_field_is(row.fields[2], "multi\nline"));
+
+    // Empty line is a row of one empty field, last line needs no terminator
+    assert(sno_csv_next(&csv, &row) && row.count == 1 && size(row.fields[0]) == 0);
+    assert(sno_csv_next(&csv, &row) && row.count == 2 && test_field_is(row.fields[1], "last"));
+    assert(!sno_csv_next(&csv, &row) && !csv.failed && csv.rows == 6);
+
+    // TSV
+    assert(sno_csv_init(&csv, bind("a\tb,c\t\n"), '\t', SNO_CSV_ALL, NULL, 0));
+    assert(sno_csv_next(&csv, &row) && row.count == 3 && test_field_is(row.fields[1], "b,c"));
+    assert(size(row.fields[2]) == 0 && !sno_csv_next(&csv, &row));
+}
+
+void test_sno_csv_projection(void) {
+    static const char text[] =
+        "a,\"x\"\"y\",c,\"d,\nd\",e\n"
+        "f,g,\"h\"\"\",i\n";
+    static char scratch[8];
+    sno_csv_t csv;
+    sno_csv_row_t row;
+
+    // Column 2 only: column 1 is stepped over without unescaping, the tail is skipped whole
+    assert(sno_csv_init(&csv, bind(text), ',', 1UL << 2, scratch, sizeof scratch));
+    assert(sno_csv_next(&csv, &row) && row.count == 3 && csv.scratch_used == 0);
+    assert(!row.fields[0].begin && !row.fields[1].begin && test_field_is(row.fields[2], "c"));
+    assert(sno_csv_next(&csv, &row) && row.count == 3 && !row.fields[1].begin);
+    assert(test_field_is(row.fields[2], "h\"") && csv.scratch_used == 2);
+    assert(!sno_csv_next(&csv, &row) && !csv.failed);
+
+    // The same column needs scratch when projected
+    assert(sno_csv_init(&csv, bind(text), ',', 1UL << 2, NULL, 0));
+    assert(sno_csv_next(&csv, &row) && !sno_csv_next(&csv, &row) && csv.failed);
+    assert(*csv.input.begin == 'f');            // left at the failing row
+}
+
+void test_sno_csv_errors(void) {
+    static char wide[SNO_CSV_FIELDS * 2 + 2];
+    sno_csv_t csv;
+    sno_csv_row_t row;
+
+    assert(sno_csv_init(&csv, bind("a,\"open\n"), ',', SNO_CSV_ALL, NULL, 0));
+    assert(!sno_csv_next(&csv, &row) && csv.failed && !sno_csv_next(&csv, &row));
+    assert(sno_csv_init(&csv, bind("\"q\"x,b\n"), ',', SNO_CSV_ALL, NULL, 0));
+    assert(!sno_csv_next(&csv, &row) && csv.failed);
+
+    // A skipped tail is checked like a projected one
+    assert(sno_csv_init(&csv, bind("a,b,\"q\"x\n"), ',', 0x1UL, NULL, 0));
+    assert(!sno_csv_next(&csv, &row) && csv.failed && *csv.input.begin == 'a');
+    assert(sno_csv_init(&csv, bind("a,b\"c,\"d\"\ne\n"), ',', 0x1UL, NULL, 0));
+    assert(sno_csv_next(&csv, &row) && row.count == 1 && sno_csv_next(&csv, &row));
+    assert(test_field_is(row.fields[0], "e") && !sno_csv_next(&csv, &row) && !csv.failed);
+
+    // One field too many, whatever the projection
+    for (unsigned int i = 0; i <= SNO_CSV_FIELDS; i++) { wide[2 * i] = 'x'; wide[2 * i + 1] = ','; }
+    wide[2 * SNO_CSV_FIELDS + 1] = '\0';
+    assert(sno_csv_init(&csv, bind(wide), ',', SNO_CSV_ALL, NULL, 0) && !sno_csv_next(&csv, &row));
+    assert(sno_csv_init(&csv, bind(wide), ',', 0x3UL, NULL, 0) && !sno_csv_next(&csv, &row) && csv.failed);
+    wide[2 * SNO_CSV_FIELDS - 1] = '\0';       // exactly at the limit
+    assert(sno_csv_init(&csv, bind(wide), ',', 0x3UL, NULL, 0) && sno_csv_next(&csv, &row) && row.count == 2);
+
+    assert(sno_csv_init(&csv, bind(""), ',', SNO_CSV_ALL, NULL, 0) && !sno_csv_next(&csv, &row) && !csv.failed);
+    assert(!sno_csv_init(&csv, bind("a"), '"', SNO_CSV_ALL, NULL, 0));
+    assert(!sno_csv_init(&csv, bind("a"), ',', SNO_CSV_ALL, NULL, 8));
+    assert(!sno_csv_init(NULL, bind("a"), ',', SNO_CSV_ALL, NULL, 0));
+    assert(!sno_csv_next(NULL, &row) && !sno_csv_next(&csv, NULL));
+}
+
+void test_sno_csv(void) {
+    test_sno_csv_rows();
+    test_sno_csv_projection();
+    test_sno_csv_errors();
+    printf("All CSV parser tests pass!\n");
+}
+
+#endif
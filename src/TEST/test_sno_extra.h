@@ -8,6 +8,7 @@
 #ifndef TEST_EXTRA_H
 #define TEST_EXTRA_H
 
+#include "../SNO/sno_core.h"
 #include "../SNO/sno_extra.h"
 #include <assert.h>
 #include <string.h>
@@ -110,10 +111,55 @@ void test_strreplace(void) {
     assert(strreplace(dst, "AaBb", "ABab", "XYxy") && strcmp(dst, "XxYy") == 0);
 }
 
+void test_bal(void) {
+    static const char text[] = "f(a, (b)) + (c))(";
+    static sno_bal_tok_t toks[8];
+    sno_bal_index_t ix;
+    view_t s;
+
+    /* Scanning: span includes the outer delimiters */
+    s = bind(text + 1);
+    assert(bal(&s, '(', ')') && s.begin == text + 9);
+    s = bind(text + 16);
+    assert(!bal(&s, '(', ')') && s.begin == text + 16);        /* never closed */
+    s = bind(text);
+    assert(!bal(&s, '(', ')'));                                 /* not at an open */
+    s = view(text + 1, text + 8);
+    assert(!bal(&s, '(', ')') && s.begin == text + 1);          /* close past the subject */
+    s = bind("'quoted' rest");
+    assert(bal(&s, '\'', '\'') && *s.begin == ' ');
+
+    /* Index: opens and closes map both ways, strays are unmatched */
+    assert(sno_bal_index(&ix, bind(text), '(', ')', toks, 8) && ix.count == 8);
+    assert(sno_bal_partner(&ix, text + 1) == text + 8 && sno_bal_partner(&ix, text + 8) == text + 1);
+    assert(sno_bal_partner(&ix, text + 5) == text + 7 && sno_bal_partner(&ix, text + 14) == text + 12);
+    assert(!sno_bal_partner(&ix, text + 15) && !sno_bal_partner(&ix, text + 16));
+    assert(!sno_bal_partner(&ix, text + 2) && !sno_bal_partner(NULL, text + 1));
+
+    /* bal_ix() agrees with the scan */
+    for (unsigned int i = 0; i < sizeof text - 1; i++) {
+        view_t a = bind(text + i), b = a;
+        bool indexed = bal_ix(&a, &ix);
+        bool scanned = bal(&b, '(', ')');
+        assert(indexed == scanned && a.begin == b.begin);
+    }
+    s = view(text + 1, text + 8);
+    assert(!bal_ix(&s, &ix) && s.begin == text + 1);
+    s = bind("(x)");                                            /* outside the index: scanned */
+    assert(bal_ix(&s, &ix) && s.begin == s.end);
+
+    /* Capacity, same delimiters, NULL safety */
+    assert(!sno_bal_index(&ix, bind(text), '(', ')', toks, 7));
+    assert(!sno_bal_index(&ix, bind(text), '|', '|', toks, 8));
+    assert(!sno_bal_index(NULL, bind(text), '(', ')', toks, 8));
+    assert(!bal(NULL, '(', ')') && !bal_ix(NULL, &ix) && !bal_ix(&s, NULL));
+}
+
 void test_sno_extra(void) {
     test_strdupl();
     test_strtrim();
     test_strreplace();
+    test_bal();
     printf("All extra utility tests pass!\n");
 }
 
@@ -0,0 +1,144 @@
+/**
+ * @file test_sno_intern.h
+ * @brief Tests for SNOBOL4-C symbol interning
+ *
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file
+ */
+#ifndef TEST_SNO_INTERN_H
+#define TEST_SNO_INTERN_H
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_constants.h"
+#include "../SNO/sno_intern.h"
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+
+void test_sno_intern_basic(void) {
+    sno_intern_t t;
+    assert(sno_intern_init(&t, 16, 128));
+
+    // Dense ids in first-seen order
+    assert(sno_intern(&t, bind("alpha")) == 0);
+    assert(sno_intern(&t, bind("beta")) == 1);
+    assert(sno_intern(&t, bind("gamma")) == 2);
+
+    // Same content, different storage: same id
+    char copy[] = "beta";
+    assert(sno_intern(&t, bind(copy)) == 1 && t.count == 3);
+
+    // Views into a larger buffer
+    char line[] = "x=alpha+beta";
+    assert(sno_intern(&t, view(&line[2], &line[7])) == 0);
+    assert(sno_intern(&t, view(&line[8], &line[12])) == 1);
+    assert(sno_intern(&t, view(&line[0], &line[1])) == 3);
+
+    // Prefixes are distinct symbols
+    assert(sno_intern(&t, bind("alp")) == 4);
+
+    // Empty name is a valid symbol
+    assert(sno_intern(&t, bind("")) == 5 && sno_intern(&t, bind("")) == 5);
+
+    // Stored names are stable, null-terminated copies
+    view_t v = sno_intern_name(&t, 2);
+    assert(size(v) == 5 && strcmp(v.begin, "gamma") == 0);
+    v = sno_intern_name(&t, 3);
+    assert(size(v) == 1 && strcmp(v.begin, "x") == 0);
+    v = sno_intern_name(&t, 99);
+    assert(!v.begin && size(v) == 0);
+    v = sno_intern_name(&t, -1);
+    assert(!v.begin);
+
+    // Find does not insert
+    assert(sno_intern_find(&t, bind("gamma")) == 2);
+    assert(sno_intern_find(&t, bind("delta")) == -1 && t.count == 6);
+
+    sno_intern_free(&t);
+    assert(!t.slots && t.count == 0);
+    assert(sno_intern(&t, bind("alpha")) == -1);
+}
+
+void test_sno_intern_limits(void) {
+    sno_intern_t t;
+
+    // Capacity bound
+    assert(sno_intern_init(&t, 2, 64));
+    assert(sno_intern(&t, bind("a")) == 0 && sno_intern(&t, bind("b")) == 1);
+    assert(sno_intern(&t, bind("c")) == -1);
+    assert(sno_intern(&t, bind("a")) == 0);     // existing names still resolve
+    sno_intern_free(&t);
+
+    // Arena bound: "abc" costs 4 bytes
+    assert(sno_intern_init(&t, 8, 7));
+    assert(sno_intern(&t, bind("abc")) == 0);
+    assert(sno_intern(&t, bind("defg")) == -1);
+    assert(sno_intern(&t, bind("de")) == 1 && t.arena_used == 7);
+    sno_intern_free(&t);
+
+    // Many symbols: probing across the full table
+    char name[8];
+    assert(sno_intern_init(&t, 300, 300 * 5));
+    for (int i = 0; i < 300; i++) {
+        sprintf(name, "s%d", i);
+        assert(sno_intern(&t, bind(name)) == i);
+    }
+    for (int i = 299; i >= 0; i--) {
+        sprintf(name, "s%d", i);
+        assert(sno_intern_find(&t, bind(name)) == i);
+    }
+    sno_intern_free(&t);
+
+    // Bad arguments
+    assert(!sno_intern_init(&t, 0, 64));
+    assert(!sno_intern_init(NULL, 8, 64));
+    assert(sno_intern(NULL, bind("a")) == -1);
+    assert(sno_intern_find(NULL, bind("a")) == -1);
+    sno_intern_free(NULL);
+}
+
+void test_sym(void) {
+    sno_intern_t t;
+    assert(sno_intern_init(&t, 16, 128));
+    view_t sub;
+    cursor_t orig;
+    int a = -1, b = -1, c = -1;
+
+    // Config evaluator: name = name
+    sub = bind("width = height");
+    assert(sym(&sub, SNO_ALNUM, &t, &a) && skip(&sub, SNO_BLANK) && chr(&sub, '=') &&
+           skip(&sub, SNO_BLANK) && sym(&sub, SNO_ALNUM, &t, &b) && sub.begin == sub.end);
+    assert(a == 0 && b == 1);
+
+    sub = bind("height");
+    assert(sym(&sub, SNO_ALNUM, &t, &c) && c == b);
+
+    // Failure: no symbol chars, cursor unchanged
+    char buf[] = "=x";
+    sub = bind(buf);
+    orig = sub.begin;
+    assert(!sym(&sub, SNO_ALNUM, &t, &a) && sub.begin == orig);
+
+    // Failure: table full, cursor unchanged
+    sno_intern_free(&t);
+    assert(sno_intern_init(&t, 1, 16));
+    sub = bind("one two");
+    assert(sym(&sub, SNO_ALNUM, &t, NULL) && span(&sub, " "));
+    orig = sub.begin;
+    assert(!sym(&sub, SNO_ALNUM, &t, &a) && sub.begin == orig);
+    sno_intern_free(&t);
+
+    // NULL safety
+    assert(!sym(NULL, SNO_ALNUM, &t, &a));
+    sub = bind("x");
+    assert(!sym(&sub, SNO_ALNUM, NULL, &a));
+}
+
+void test_sno_intern(void) {
+    test_sno_intern_basic();
+    test_sno_intern_limits();
+    test_sym();
+    printf("All symbol interning tests pass!\n");
+}
+
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file test_sno_json.h
+ * @brief Tests for SNOBOL4-C JSON structural index and navigation
+ *
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file
+ */
+#ifndef TEST_SNO_JSON_H
+#define TEST_SNO_JSON_H
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_json.h"
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+
+static sno_json_tok_t test_json_toks[64];
+
+static bool test_json_span(cursor_t begin, cursor_t end, const char* text) {
+    return (size_t)(end - begin) == strlen(text) && memcmp(begin, text, strlen(text)) == 0;
+}
+
+void test_sno_json_index(void) {
+    sno_json_index_t ix;
+    const char* doc = "{\"a\": [1, {\"b\": \"}\"}], \"c\\\"\": \"x\\\\\"}";
+
+    // { " " : [ , { " " : " " } ] , " " : " " }
+    assert(sno_json_index(&ix, bind(doc), test_json_toks, 64) && ix.count == 21);
+    assert(ix.toks[0].link == 20 && ix.toks[20].link == 0);             // outer braces
+    assert(ix.toks[4].link == 13 && ix.toks[5].link == 4);              // array, its ','
+    assert(ix.toks[1].link == 2 && ix.toks[2].link == 1);               // "a"
+    assert(doc[ix.toks[16].at] == '"' && ix.toks[16].at == 27);         // "c\"" ends after the escape
+    assert(ix.toks[19].at == 34);                                       // "x\\" ends at the next quote
+
+    // Structural errors and capacity
+    assert(!sno_json_index(&ix, bind("{[}]"), test_json_toks, 64) && ix.count == 0);
+    assert(!sno_json_index(&ix, bind("{\"a\":1"), test_json_toks, 64));
+    assert(!sno_json_index(&ix, bind("[\"open]"), test_json_toks, 64));
+    assert(!sno_json_index(&ix, bind("]"), test_json_toks, 64));
+    assert(!sno_json_index(&ix, bind(doc), test_json_toks, 20));
+    assert(!sno_json_index(NULL, bind(doc), test_json_toks, 64));
+    assert(!sno_json_index(&ix, bind(doc), NULL, 64));
+    assert(sno_json_index(&ix, bind("  42 "), test_json_toks, 64) && ix.count == 0);
+}
+
+void test_sno_json_navigation(void) {
+    static const char lines[] =
+        "{\"id\": 7, \"tags\": [\"x\", {\"k\": [10, 20 ,30]}], \"name\": \"a{b\"}\n"
+        "{\"id\":8,\"empty\":[],\"obj\":{}}\n";
+    sno_json_index_t ix;
+    assert(sno_json_index(&ix, bind(lines), test_json_toks, 64));
+
+    view_t s = bind(lines), v;
+    cursor_t start;
+
+    // Walk down: tags[1].k[2]
+    v = s;
+    assert(jkey(&v, &ix, "tags") && *v.begin == '[');
+    assert(jindex(&v, &ix, 1) && *v.begin == '{');
+    assert(jkey(&v, &ix, "k") && jindex(&v, &ix, 2));
+    start = v.begin;
+    assert(jvalue(&v, &ix) && test_json_span(start, v.begin, "30"));
+
+    // Values: scalar, string with a brace inside, whole containers
+    v = s;
+    assert(jkey(&v, &ix, "id") && (start = v.begin, jvalue(&v, &ix)) && test_json_span(start, v.begin, "7"));
+    v = s;
+    assert(jkey(&v, &ix, "name") && (start = v.begin, jvalue(&v, &ix)) && test_json_span(start, v.begin, "\"a{b\""));
+    v = s;
+    assert(jkey(&v, &ix, "tags") && (start = v.begin, jbal(&v, &ix)));
+    assert(test_json_span(start, v.begin, "[\"x\", {\"k\": [10, 20 ,30]}]") && *v.begin == ',');
+
+    // Next line: a whole object is one jump
+    v = s;
+    assert(jbal(&v, &ix) && *v.begin == '\n' && (v.begin++, *v.begin == '{'));
+    view_t line2 = v;
+    assert(jkey(&v, &ix, "id") && *v.begin == '8');
+    v = line2;
+    assert(jkey(&v, &ix, "obj") && test_json_span(v.begin, v.begin + 2, "{}"));
+
+    // Failures leave the cursor unchanged
+    v = line2;
+    assert(!jkey(&v, &ix, "missing") && !jkey(&v, &ix, "i") && v.begin == line2.begin);
+    assert(jkey(&v, &ix, "empty") && !jindex(&v, &ix, 0) && *v.begin == '[');
+    v = s;
+    assert(jkey(&v, &ix, "tags") && !jindex(&v, &ix, 2) && !jkey(&v, &ix, "x") && *v.begin == '[');
+    v = s;
+    assert(!jindex(&v, &ix, 0) && !jkey(&v, &ix, "k"));                // "k" is nested, not a member
+    v = view(s.begin + 1, s.end);
+    assert(jbal(&v, &ix) && v.begin == s.begin + 5);                    // the string "id"
+    v = view(s.begin + 4, s.end);                                       // on its closing quote
+    assert(!jbal(&v, &ix) && v.begin == s.begin + 4);
+    assert(!jvalue(&v, &ix) && v.begin == s.begin + 4);
+    {
+        static sno_json_tok_t toks[16];
+        view_t t = bind("{\"k\": \"ab\", \"n\": [1, 2]}");
+        sno_json_index_t jx;
+        assert(sno_json_index(&jx, t, toks, 16));
+        v = view(t.begin + 9, t.end);                                   // closing quote of "ab"
+        assert(!jvalue(&v, &jx) && v.begin == t.begin + 9);
+        v = view(t.begin + 6, t.end);
+        assert(jvalue(&v, &jx) && v.begin == t.begin + 10);
+    }
+    v = view(s.begin + 6, s.end);                                       // whitespace
+    assert(!jvalue(&v, &ix));
+    v = view(s.begin, s.begin + 10);                                    // object runs past the subject
+    assert(!jbal(&v, &ix) && v.begin == s.begin);
+    assert(!jbal(NULL, &ix) && !jbal(&v, NULL) && !jkey(&v, &ix, NULL));
+}
+
+void test_sno_json(void) {
+    test_sno_json_index();
+    test_sno_json_navigation();
+    printf("All JSON index tests pass!\n");
+}
+
+#endif
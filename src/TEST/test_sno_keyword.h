@@ -0,0 +1,127 @@
+/**
+ * @file test_sno_keyword.h
+ * @brief Tests for SNOBOL4-C perfect hash keyword recognizer
+ *
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file
+ */
+#ifndef TEST_SNO_KEYWORD_H
+#define TEST_SNO_KEYWORD_H
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_constants.h"
+#include "../SNO/sno_keyword.h"
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+
+// edlin command words
+static const char* const test_commands[] = {
+    "append", "copy", "delete", "edit", "end", "insert",
+    "list", "move", "page", "quit", "replace", "search", "transfer", "write"
+};
+#define TEST_COMMAND_COUNT (sizeof(test_commands) / sizeof(test_commands[0]))
+
+void test_sno_keywords_build(void) {
+    sno_keywords_t kw;
+    uint8_t disp[SNO_KEYWORD_SLOTS], slots[SNO_KEYWORD_SLOTS];
+
+    assert(sno_keywords_build(&kw, test_commands, TEST_COMMAND_COUNT, disp, slots));
+    assert(kw.mask + 1u >= TEST_COMMAND_COUNT);
+
+    // Every slot holds a valid id or NONE, every id exactly once
+    unsigned int seen = 0;
+    for (unsigned int s = 0; s <= kw.mask; s++) {
+        assert(slots[s] == SNO_KEYWORD_NONE || slots[s] < TEST_COMMAND_COUNT);
+        if (slots[s] != SNO_KEYWORD_NONE) seen++;
+    }
+    assert(seen == TEST_COMMAND_COUNT);
+
+    // Single keyword
+    const char* one[] = {"only"};
+    assert(sno_keywords_build(&kw, one, 1, disp, slots) && sno_keyword(&kw, bind("only")) == 0);
+
+    // Rejected: duplicates, empty keyword, empty list, NULL args
+    const char* dup[] = {"if", "else", "if"};
+    assert(!sno_keywords_build(&kw, dup, 3, disp, slots));
+    const char* empty[] = {"if", ""};
+    assert(!sno_keywords_build(&kw, empty, 2, disp, slots));
+    assert(!sno_keywords_build(&kw, test_commands, 0, disp, slots));
+    assert(!sno_keywords_build(NULL, test_commands, TEST_COMMAND_COUNT, disp, slots));
+    assert(!sno_keywords_build(&kw, test_commands, TEST_COMMAND_COUNT, NULL, slots));
+}
+
+void test_sno_keyword(void) {
+    sno_keywords_t kw;
+    uint8_t disp[SNO_KEYWORD_SLOTS], slots[SNO_KEYWORD_SLOTS];
+    assert(sno_keywords_build(&kw, test_commands, TEST_COMMAND_COUNT, disp, slots));
+
+    // Every keyword maps to its own id
+    for (unsigned int i = 0; i < TEST_COMMAND_COUNT; i++)
+        assert(sno_keyword(&kw, bind(test_commands[i])) == (int)i);
+
+    // Non-keywords: prefixes, extensions, case, empty
+    assert(sno_keyword(&kw, bind("ed")) == -1);
+    assert(sno_keyword(&kw, bind("edits")) == -1);
+    assert(sno_keyword(&kw, bind("LIST")) == -1);
+    assert(sno_keyword(&kw, bind("xyzzy")) == -1);
+    assert(sno_keyword(&kw, bind("")) == -1);
+    assert(sno_keyword(&kw, view(NULL, NULL)) == -1);
+    assert(sno_keyword(NULL, bind("list")) == -1);
+
+    // Token inside a larger buffer
+    char line[] = "  move 1,5";
+    view_t token = view(&line[2], &line[6]);
+    assert(sno_keyword(&kw, token) == 7);
+}
+
+void test_kwd(void) {
+    sno_keywords_t kw;
+    uint8_t disp[SNO_KEYWORD_SLOTS], slots[SNO_KEYWORD_SLOTS];
+    assert(sno_keywords_build(&kw, test_commands, TEST_COMMAND_COUNT, disp, slots));
+
+    view_t sub;
+    cursor_t orig;
+    int id = -1;
+
+    // Keyword then argument
+    sub = bind("list 1,20");
+    assert(kwd(&sub, SNO_ALNUM, &kw, &id) && id == 6 && *sub.begin == ' ');
+
+    // Whole span must be a keyword
+    char buf1[] = "listing";
+    sub = bind(buf1);
+    orig = sub.begin;
+    assert(!kwd(&sub, SNO_ALNUM, &kw, &id) && sub.begin == orig);
+
+    // Not an identifier at cursor
+    char buf2[] = " quit";
+    sub = bind(buf2);
+    orig = sub.begin;
+    assert(!kwd(&sub, SNO_ALNUM, &kw, &id) && sub.begin == orig);
+
+    // Composition: skip blanks, keyword, skip blanks, number
+    int n;
+    sub = bind("  delete  12");
+    assert(skip(&sub, SNO_BLANK) && kwd(&sub, SNO_LOWER, &kw, &id) && id == 2 &&
+           skip(&sub, SNO_BLANK) && num(&sub, &n) && n == 12 && sub.begin == sub.end);
+
+    // id pointer optional
+    sub = bind("end");
+    assert(kwd(&sub, SNO_LOWER, &kw, NULL) && sub.begin == sub.end);
+
+    // NULL safety
+    assert(!kwd(NULL, SNO_ALNUM, &kw, &id));
+    sub = bind("end");
+    assert(!kwd(&sub, NULL, &kw, &id));
+    assert(!kwd(&sub, SNO_ALNUM, NULL, &id));
+}
+
+void test_sno_keywords(void) {
+    test_sno_keywords_build();
+    test_sno_keyword();
+    test_kwd();
+    printf("All keyword recognizer tests pass!\n");
+}
+
+#endif
@@ -0,0 +1,152 @@
+/**
+ * @file test_sno_lexcache.h
+ * @brief Tests for SNOBOL4-C incremental per-line tokenizer driver
+ *
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file
+ */
+#ifndef TEST_SNO_LEXCACHE_H
+#define TEST_SNO_LEXCACHE_H
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_lexcache.h"
+#include <assert.h>
+#include <stdio.h>
+
+#define TEST_LEX_LINES 64
+
+enum { TEST_LEX_CODE, TEST_LEX_COMMENT };
+
+typedef struct {
+    const char*  lines[TEST_LEX_LINES];
+    unsigned int count;
+    unsigned int lexed;     // tokenizer calls
+} test_lex_doc_t;
+
+// C block comments: the only state carried from line to line
+static sno_lexstate_t test_lex_line(void* ctx, unsigned int line, sno_lexstate_t state) {
+    test_lex_doc_t* doc = ctx;
+    view_t s = bind(doc->lines[line]);
+    doc->lexed++;
+    while (s.begin < s.end) {
+        if (state == TEST_LEX_COMMENT) {
+            if (str(&s, "*/")) state = TEST_LEX_CODE;
+            else len(&s, 1);
+        } else {
+            if (str(&s, "/*")) state = TEST_LEX_COMMENT;
+            else if (str(&s, "//")) break;
+            else len(&s, 1);
+        }
+    }
+    return state;
+}
+
+static void test_lex_replace(test_lex_doc_t* doc, unsigned int line, unsigned int removed,
+                             const char* const* text, unsigned int inserted) {
+    unsigned int tail = doc->count - line - removed;
+    if (inserted > removed)
+        for (unsigned int i = tail; i-- > 0; ) doc->lines[line + inserted + i] = doc->lines[line + removed + i];
+    else
+        for (unsigned int i = 0; i < tail; i++) doc->lines[line + inserted + i] = doc->lines[line + removed + i];
+    for (unsigned int i = 0; i < inserted; i++) doc->lines[line + i] = text[i];
+    doc->count += inserted - removed;
+}
+
+// Cached states must equal a full re-scan
+static bool test_lex_consistent(sno_lexcache_t* c, test_lex_doc_t* doc) {
+    sno_lexstate_t state = TEST_LEX_CODE;
+    unsigned int lexed = doc->lexed;
+    for (unsigned int i = 0; i <= doc->count; i++) {
+        if (sno_lexcache_state(c, i) != state) return false;
+        if (i < doc->count) state = test_lex_line(doc, i, state);
+    }
+    doc->lexed = lexed;
+    return c->lines == doc->count;
+}
+
+void test_sno_lexcache_edits(void) {
+    static const char* const text[] = {
+        "int a;", "/* header", "   still comment", "*/", "int b; // note /*", "int c;", "int d;", "int e;",
+    };
+    static const char* const open[] = {"x = 1; /* opened"};
+    static const char* const plain[] = {"x = 2;"};
+    static const char* const two[] = {"y;", "z;"};
+    static test_lex_doc_t doc;
+    static sno_lexstate_t states[TEST_LEX_LINES + 1];
+    sno_lexcache_t c;
+
+    assert(sno_lexcache_init(&c, test_lex_line, &doc, states, TEST_LEX_LINES + 1, TEST_LEX_CODE));
+    test_lex_replace(&doc, 0, 0, text, 8);
+    assert(sno_lexcache_edit(&c, 0, 0, 8) && sno_lexcache_update(&c) == 8);
+    assert(test_lex_consistent(&c, &doc));
+    assert(sno_lexcache_state(&c, 2) == TEST_LEX_COMMENT && sno_lexcache_state(&c, 4) == TEST_LEX_CODE);
+
+    // A change that keeps the end state re-scans one line
+    doc.lexed = 0;
+    test_lex_replace(&doc, 5, 1, plain, 1);
+    assert(sno_lexcache_edit(&c, 5, 1, 1) && sno_lexcache_update(&c) == 1 && doc.lexed == 1);
+    assert(test_lex_consistent(&c, &doc));
+
+    // Opening a comment runs to the end of the document, closing it again converges
+    test_lex_replace(&doc, 5, 1, open, 1);
+    assert(sno_lexcache_edit(&c, 5, 1, 1) && sno_lexcache_update(&c) == 3);
+    assert(test_lex_consistent(&c, &doc) && sno_lexcache_state(&c, 8) == TEST_LEX_COMMENT);
+    test_lex_replace(&doc, 5, 1, plain, 1);
+    assert(sno_lexcache_edit(&c, 5, 1, 1) && sno_lexcache_update(&c) == 3);
+    assert(test_lex_consistent(&c, &doc));
+
+    // Deleting the comment's closing line reopens everything after it
+    test_lex_replace(&doc, 3, 1, NULL, 0);
+    assert(sno_lexcache_edit(&c, 3, 1, 0) && sno_lexcache_update(&c) == 4);
+    assert(test_lex_consistent(&c, &doc) && sno_lexcache_state(&c, 7) == TEST_LEX_COMMENT);
+
+    // Several edits before one update: inserted lines are always scanned
+    test_lex_replace(&doc, 0, 0, two, 2);
+    assert(sno_lexcache_edit(&c, 0, 0, 2));
+    test_lex_replace(&doc, 8, 0, two, 2);
+    assert(sno_lexcache_edit(&c, 8, 0, 2));
+    doc.lexed = 0;
+    assert(sno_lexcache_update(&c) == 10 && test_lex_consistent(&c, &doc));
+    assert(sno_lexcache_update(&c) == 0);          // nothing pending
+
+    // Bad edits
+    assert(!sno_lexcache_edit(&c, c.lines + 1, 0, 1));
+    assert(!sno_lexcache_edit(&c, 0, c.lines + 1, 0));
+    assert(!sno_lexcache_edit(&c, 0, 0, TEST_LEX_LINES));
+    assert(!sno_lexcache_edit(NULL, 0, 0, 1) && !sno_lexcache_init(&c, NULL, &doc, states, 1, 0));
+    assert(sno_lexcache_state(&c, c.lines + 1) == 0);
+}
+
+// Random edits against a full re-scan
+void test_sno_lexcache_random(void) {
+    static const char* const pool[] = {"a", "/*", "*/", "b /* c */ d", "// /*", "*/ /*", "e */ f"};
+    static test_lex_doc_t doc;
+    static sno_lexstate_t states[TEST_LEX_LINES + 1];
+    sno_lexcache_t c;
+    unsigned long seed = 7;
+
+    doc.count = 0;
+    assert(sno_lexcache_init(&c, test_lex_line, &doc, states, TEST_LEX_LINES + 1, TEST_LEX_CODE));
+    for (unsigned int step = 0; step < 2000; step++) {
+        const char* text[3];
+        seed = seed * 1103515245UL + 12345UL;
+        unsigned int line = (unsigned int)((seed >> 16) % (doc.count + 1));
+        unsigned int removed = (unsigned int)((seed >> 8) % 3);
+        unsigned int inserted = (unsigned int)((seed >> 12) % 3);
+        if (removed > doc.count - line) removed = doc.count - line;
+        if (doc.count - removed + inserted >= TEST_LEX_LINES) inserted = 0;
+        for (unsigned int i = 0; i < inserted; i++) text[i] = pool[(seed >> (20 + 3 * i)) % 7];
+
+        test_lex_replace(&doc, line, removed, text, inserted);
+        assert(sno_lexcache_edit(&c, line, removed, inserted));
+        if (step % 3 == 0) assert(sno_lexcache_update(&c) <= doc.count && test_lex_consistent(&c, &doc));
+    }
+}
+
+void test_sno_lexcache(void) {
+    test_sno_lexcache_edits();
+    test_sno_lexcache_random();
+    printf("All incremental tokenizer tests pass!\n");
+}
+
+#endif
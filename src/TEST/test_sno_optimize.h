@@ -0,0 +1,120 @@
+/**
+ * @file test_sno_optimize.h
+ * @brief Tests for SNOBOL4-C compiled pattern optimizer
+ *
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file
+ */
+#ifndef TEST_SNO_OPTIMIZE_H
+#define TEST_SNO_OPTIMIZE_H
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_regex.h"
+#include "../SNO/sno_optimize.h"
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+
+static sno_pattern_t test_opt;
+
+static const sno_pattern_t* test_optimized(const char* re) {
+    assert(sno_regex(&test_opt, re, NULL));
+    assert(sno_optimize(&test_opt) >= 0 && sno_pattern_check(&test_opt));
+    return &test_opt;
+}
+
+static bool test_op_is(const sno_pattern_t* p, uint16_t pc, uint8_t op, const char* operand) {
+    return pc < p->count && p->prog[pc].op == op &&
+           (!operand || strcmp(p->pool + p->prog[pc].arg, operand) == 0);
+}
+
+void test_sno_optimize_rewrites(void) {
+    const sno_pattern_t* p;
+
+    // Literal fusion
+    p = test_optimized("GET /");
+    assert(p->count == 2 && test_op_is(p, 0, SNO_OP_STR, "GET /") && test_op_is(p, 1, SNO_OP_MATCH, NULL));
+    assert(p->pool_used == 6);      // intermediate literals are gone from the pool
+
+    // Charset merges
+    p = test_optimized("(a|b|[cd])");
+    assert(p->count == 2 && test_op_is(p, 0, SNO_OP_ANY, "abcd"));
+    p = test_optimized("(a|b)*x");
+    assert(p->count == 3 && test_op_is(p, 0, SNO_OP_SKIP, "ab") && p->prog[1].op == SNO_OP_CHR);
+    p = test_optimized("(a|b)+");
+    assert(p->count == 2 && test_op_is(p, 0, SNO_OP_SPAN, "ab"));
+    p = test_optimized("([0-9]+)?;");
+    assert(p->count == 3 && test_op_is(p, 0, SNO_OP_SKIP, "0123456789"));
+    p = test_optimized("[0-9]+[0-9]*");
+    assert(p->count == 2 && test_op_is(p, 0, SNO_OP_SPAN, "0123456789"));
+
+    // Dead sequences: skip already took every x, brk stops only at ','
+    p = test_optimized("x*x+");
+    assert(p->count == 1 && p->prog[0].op == SNO_OP_FAIL);
+    p = test_optimized("[^,]*a");
+    assert(p->count == 1 && p->prog[0].op == SNO_OP_FAIL);
+    p = test_optimized("k(x*x+|=)");
+    assert(p->count == 2 && test_op_is(p, 0, SNO_OP_STR, "k="));
+
+    // Dead branches after an alternative that cannot fail
+    p = test_optimized("(x*|y)z");
+    assert(p->count == 3 && test_op_is(p, 0, SNO_OP_SKIP, "x") && p->prog[1].op == SNO_OP_CHR);
+
+    // Disjoint alternatives, widest first set first
+    p = test_optimized("(ab|[0-9]+|cd)");
+    assert(p->prog[0].op == SNO_OP_CHOICE && test_op_is(p, 1, SNO_OP_SPAN, "0123456789"));
+    // Overlapping first bytes keep their order
+    p = test_optimized("(ab|[a-z]+)");
+    assert(p->prog[0].op == SNO_OP_CHOICE && test_op_is(p, 1, SNO_OP_STR, "ab"));
+
+    // Already optimal
+    assert(sno_regex(&test_opt, "[a-z]+=", NULL) && sno_optimize(&test_opt) == 0);
+
+    // NULL and damaged programs
+    assert(sno_optimize(NULL) == -1);
+    test_opt.prog[0].op = 0xEE;
+    assert(sno_optimize(&test_opt) == -1);
+}
+
+// Optimized and original programs must agree on every subject and start position
+void test_sno_optimize_equivalence(void) {
+    static const char* const res[] = {
+        "abc", "(a|b|[xy])+", "(ab|x*y|[0-9]+)", "(a|ab)b", "x*x+", "(x*|y)z",
+        "[^,]*,(a|b)?", "([0-9]+)?,", "(a*)*b", "((ab)*)?x", "^(a|b)*$", "a(b|c)*d",
+        "(ab|cd)*(ab|cd)", "[ab]+[ab]*[^ab]", "(x|y|z)(x|y|z)", ",*[^,]*,+",
+        "(GET|POST|PUT) /[a-z]*", "\\d+\\.?\\d*", "(a|)(b|)c", "a?a?a",
+        "(((x|.+.|.+a))b)*",    // dead alternatives inside a loop
+    };
+    static const char alphabet[] = "abcdxyz0,. /\nGETPOSU";
+    static sno_pattern_t base;
+    unsigned long seed = 1;
+    char text[16];
+
+    for (unsigned int k = 0; k < sizeof res / sizeof res[0]; k++) {
+        assert(sno_regex(&base, res[k], NULL));
+        test_opt = base;
+        assert(sno_optimize(&test_opt) >= 0 && test_opt.count <= base.count);
+
+        for (unsigned int trial = 0; trial < 300; trial++) {
+            seed = seed * 1103515245UL + 12345UL;
+            size_t n = (seed >> 16) % sizeof text;
+            for (size_t i = 0; i < n; i++) {
+                seed = seed * 1103515245UL + 12345UL;
+                text[i] = alphabet[(seed >> 16) % (sizeof alphabet - 1)];
+            }
+            for (size_t at = 0; at <= n; at++) {
+                view_t a = view(text + at, text + n), b = a;
+                bool ma = sno_exec(&base, &a, text), mb = sno_exec(&test_opt, &b, text);
+                assert(ma == mb && a.begin == b.begin);
+            }
+        }
+    }
+}
+
+void test_sno_optimize(void) {
+    test_sno_optimize_rewrites();
+    test_sno_optimize_equivalence();
+    printf("All pattern optimizer tests pass!\n");
+}
+
+#endif
@@ -0,0 +1,141 @@
+/**
+ * @file test_sno_regex.h
+ * @brief Tests for SNOBOL4-C compiled patterns and the regex subset front end
+ *
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file
+ */
+#ifndef TEST_SNO_REGEX_H
+#define TEST_SNO_REGEX_H
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_pattern.h"
+#include "../SNO/sno_regex.h"
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+
+// Anchored match length, -1 on failure (cursor must then be untouched)
+static int test_regex_run(const char* re, const char* text) {
+    static sno_pattern_t p;
+    const char* error;
+    assert(sno_regex(&p, re, &error) && error == NULL);
+
+    view_t s = bind(text);
+    cursor_t start = s.begin;
+    if (!pat(&s, &p)) {
+        assert(s.begin == start);
+        return -1;
+    }
+    return (int)(s.begin - start);
+}
+
+void test_sno_regex_match(void) {
+    static const struct { const char* re; const char* text; int length; } cases[] = {
+        {"",                "abc",          0},
+        {"abc",             "abcd",         3},
+        {"abc",             "abx",         -1},
+        {"a.c",             "a-c",          3},
+        {"a.c",             "a\nc",        -1},
+        {"[0-9]+",          "2026-10",      4},
+        {"[0-9]+",          "x1",          -1},
+        {"[0-9]*x",         "x",            1},
+        {"[^,]*,",          "key,val",      4},
+        {"[^,]+,",          ",",           -1},
+        {"[]a]+",           "a]]b",         3},
+        {"[a\\-z]+",        "a-zb",         3},
+        {"\\d+\\.\\d*",     "3.14x",        4},
+        {"\\w+\\s*=",       "name_1 \t=",   9},
+        {"\\D\\W\\S",       "a.b",          3},
+        {"colou?r",         "color",        5},
+        {"colou?r",         "colour",       6},
+        {"(GET|POST|PUT) /","POST /",       6},
+        {"(GET|POST|PUT) /","PATCH /",     -1},
+        {"a|ab",            "ab",           1},     // ordered choice
+        {"(ab)*c",          "ababc",        5},
+        {"(ab)+c",          "c",           -1},
+        {"(ab)+c",          "abc",          3},
+        {"(a|b)+c",         "abbac",        5},
+        {"x(a|bc|d)?y",     "xbcy",         4},
+        {"x(a|bc|d)?y",     "xy",           2},
+        {"((ab)*)?c",       "ababc",        5},
+        {"(ab|cd)*e",       "abcdabe",      7},
+        {"(a*)*b",          "aab",          3},     // empty iteration ends the loop
+        {"()+x",            "x",            1},
+        {"^ab$",            "ab",           2},
+        {"^ab$",            "ab\ncd",       2},
+        {"^ab$",            "abc",         -1},
+        {"[a-z]*z",         "az",          -1},     // possessive
+        {"[a-y]*z",         "az",           2},
+        {"k=(\\d+|\\w+);",  "k=12;",        5},
+        {"k=(\\d+|\\w+);",  "k=ab;",        5},
+        {"k=(\\d+|\\w+);",  "k=1a;",       -1},     // \d+ committed, ';' fails, no give back
+    };
+
+    for (unsigned int i = 0; i < sizeof cases / sizeof cases[0]; i++)
+        assert(test_regex_run(cases[i].re, cases[i].text) == cases[i].length);
+}
+
+void test_sno_regex_program(void) {
+    sno_pattern_t p;
+
+    // Runs compile straight to primitives
+    assert(sno_regex(&p, "[a-c]+[^;]*x?", NULL));
+    assert(p.count == 6);
+    assert(p.prog[0].op == SNO_OP_SPAN && strcmp(p.pool + p.prog[0].arg, "abc") == 0);
+    assert(p.prog[1].op == SNO_OP_BRK && strcmp(p.pool + p.prog[1].arg, ";") == 0);
+    assert(p.prog[2].op == SNO_OP_CHOICE && p.prog[2].arg == 5);
+    assert(p.prog[3].op == SNO_OP_CHR && p.prog[3].arg == 'x');
+    assert(p.prog[4].op == SNO_OP_COMMIT && p.prog[4].arg == 5);
+    assert(p.prog[5].op == SNO_OP_MATCH);
+
+    // Identical charsets share pool space
+    assert(sno_regex(&p, "\\d+-\\d+", NULL));
+    assert(p.prog[0].arg == p.prog[2].arg && p.pool_used == 11);
+
+    // '^' holds at the origin or after a newline when run mid-text
+    const char* text = "xx\nab";
+    assert(sno_regex(&p, "^ab", NULL));
+    view_t s = view(text + 3, text + 5);
+    assert(sno_exec(&p, &s, text) && s.begin == text + 5);
+    s = view(text + 1, text + 5);
+    assert(!sno_exec(&p, &s, text) && s.begin == text + 1);
+}
+
+void test_sno_regex_errors(void) {
+    sno_pattern_t p;
+    const char* error;
+
+    static const struct { const char* re; int at; } cases[] = {
+        {"*a", 0}, {"a**", 2}, {"(ab", 3}, {"ab)", 2}, {"[a-", 3},
+        {"[z-a]", 4}, {"a{2}", 1}, {"\\q", 1}, {"^*", 1}, {"a\\", 2},
+    };
+    for (unsigned int i = 0; i < sizeof cases / sizeof cases[0]; i++) {
+        assert(!sno_regex(&p, cases[i].re, &error));
+        assert(error == cases[i].re + cases[i].at);
+        assert(p.count == 0);   // a failed compile leaves a pattern that matches nothing
+    }
+
+    // Too many groups or instructions
+    assert(!sno_regex(&p, "((((((((((((((((((x))))))))))))))))))", NULL));
+    char big[SNO_PATTERN_PROG + 2];
+    memset(big, 'a', sizeof big - 1);
+    big[sizeof big - 1] = '\0';
+    assert(!sno_regex(&p, big, &error) && error != NULL);
+
+    // NULL safety
+    view_t s = bind("a");
+    assert(!sno_regex(NULL, "a", NULL));
+    assert(!sno_regex(&p, NULL, &error) && error == NULL);
+    assert(!pat(NULL, &p) && !pat(&s, NULL));
+    assert(!pat(&s, &p));   // empty program
+}
+
+void test_sno_regex(void) {
+    test_sno_regex_match();
+    test_sno_regex_program();
+    test_sno_regex_errors();
+    printf("All regex front end tests pass!\n");
+}
+
+#endif
@@ -0,0 +1,111 @@
+/**
+ * @file test_sno_scan.h
+ * @brief Tests for SNOBOL4-C lazy all-matches enumeration
+ *
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file
+ */
+#ifndef TEST_SNO_SCAN_H
+#define TEST_SNO_SCAN_H
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_regex.h"
+#include "../SNO/sno_scan.h"
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+
+// Enumerate all matches as "begin:length" pairs joined by ' '
+static const char* test_scan_all(const char* re, const char* text, bool overlap, uint8_t* filter) {
+    static char out[128];
+    static sno_pattern_t p;
+    sno_scan_t it;
+    view_t m;
+
+    assert(sno_regex(&p, re, NULL));
+    assert(sno_scan_init(&it, &p, bind(text), overlap));
+    if (filter) *filter = it.filter;
+
+    out[0] = '\0';
+    while (sno_scan_next(&it, &m))
+        sprintf(out + strlen(out), "%s%d:%d", out[0] ? " " : "", (int)(m.begin - text), (int)size(m));
+    assert(!sno_scan_next(&it, &m));    // exhausted stays exhausted
+    return out;
+}
+
+void test_sno_scan_matches(void) {
+    uint8_t filter;
+
+    assert(strcmp(test_scan_all("ab", "xxabyabab", false, &filter), "2:2 5:2 7:2") == 0);
+    assert(filter == SNO_SCAN_BYTE);
+
+    assert(strcmp(test_scan_all("[0-9]+", "a1b22c333", false, &filter), "1:1 3:2 6:3") == 0);
+    assert(filter == SNO_SCAN_SET);
+
+    // Overlapping matches start at every position
+    assert(strcmp(test_scan_all("aa", "aaaa", false, NULL), "0:2 2:2") == 0);
+    assert(strcmp(test_scan_all("aa", "aaaa", true, NULL), "0:2 1:2 2:2") == 0);
+    assert(strcmp(test_scan_all("[0-9]+", "12", true, NULL), "0:2 1:1") == 0);
+
+    // Empty matches advance one byte and include the end position
+    assert(strcmp(test_scan_all("a*", "baa", false, &filter), "0:0 1:2 3:0") == 0);
+    assert(filter == SNO_SCAN_ALL);
+
+    // Alternatives and optional prefixes widen the first set
+    assert(strcmp(test_scan_all("(GET|PUT) /", "PUT /x GET /y POST /z", false, &filter), "0:5 7:5") == 0);
+    assert(filter == SNO_SCAN_SET);
+    assert(strcmp(test_scan_all("-?[0-9]", "x-1 2", false, &filter), "1:2 4:1") == 0);
+    assert(filter == SNO_SCAN_SET);
+
+    // '^' sees line starts in the whole subject
+    assert(strcmp(test_scan_all("^[a-z]+", "ab cd\nef", false, NULL), "0:2 6:2") == 0);
+
+    // No match at all
+    assert(strcmp(test_scan_all("zz", "abc", false, NULL), "") == 0);
+    assert(strcmp(test_scan_all("zz", "", false, NULL), "") == 0);
+}
+
+void test_sno_scan_lazy(void) {
+    sno_pattern_t p;
+    sno_scan_t it;
+    view_t m;
+    const char* text = "k=1 k=2 k=3 k=4";
+
+    // Stop after the first two hits, nothing beyond them is examined
+    assert(sno_regex(&p, "k=\\d", NULL));
+    assert(sno_scan_init(&it, &p, bind(text), false));
+    assert(sno_scan_next(&it, &m) && m.begin == text);
+    assert(sno_scan_next(&it, &m) && m.begin == text + 4);
+    assert(it.next == text + 7);
+
+    // NULL safety
+    assert(!sno_scan_init(NULL, &p, bind(text), false));
+    assert(!sno_scan_init(&it, NULL, bind(text), false));
+    assert(!sno_scan_next(NULL, &m));
+    assert(!sno_scan_next(&it, NULL));
+}
+
+void test_sno_scan_first(void) {
+    sno_pattern_t p;
+    uint8_t first[32];
+
+    assert(sno_regex(&p, "(ab)*c", NULL) && sno_pattern_first(&p, 0, p.count, first));
+    assert((first['a' >> 3] & (1u << ('a' & 7))) && (first['c' >> 3] & (1u << ('c' & 7))));
+    assert(!(first['b' >> 3] & (1u << ('b' & 7))));
+
+    // Negated sets start with anything else; nullable or brk patterns have no first set
+    assert(sno_regex(&p, "[^a]", NULL) && sno_pattern_first(&p, 0, p.count, first));
+    assert(!(first['a' >> 3] & (1u << ('a' & 7))) && (first['b' >> 3] & (1u << ('b' & 7))));
+    assert(sno_regex(&p, "x?", NULL) && !sno_pattern_first(&p, 0, p.count, first));
+    assert(sno_regex(&p, "[^,]*,", NULL) && !sno_pattern_first(&p, 0, p.count, first));
+    assert(!sno_pattern_first(NULL, 0, 0, first));
+}
+
+void test_sno_scan(void) {
+    test_sno_scan_matches();
+    test_sno_scan_lazy();
+    test_sno_scan_first();
+    printf("All match enumeration tests pass!\n");
+}
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * @file test_sno_store.h
+ * @brief Tests for SNOBOL4-C serialized compiled patterns
+ *
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file
+ */
+#ifndef TEST_SNO_STORE_H
+#define TEST_SNO_STORE_H
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_regex.h"
+#include "../SNO/sno_store.h"
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+
+static const char* const test_store_res[] = {"(GET|POST) /[a-z]*", "\\d+\\.\\d+", "[^=]+="};
+
+void test_sno_store_roundtrip(void) {
+    static sno_pattern_t set[3];
+    static uint16_t image[(sizeof(sno_store_header_t) + sizeof set) / 2 + 8];  // 2 byte aligned
+    const char* file = "snopat.001";
+    uint16_t count = 0;
+
+    for (unsigned int i = 0; i < 3; i++) assert(sno_regex(&set[i], test_store_res[i], NULL));
+    assert(sno_store_size(3) == sizeof(sno_store_header_t) + sizeof set);
+    assert(sno_store_save(file, set, 3));
+
+    // One read, then the patterns are used in place
+    const sno_pattern_t* loaded = sno_store_load(file, image, sizeof image, &count);
+    assert(loaded == (const sno_pattern_t*)((const char*)image + sizeof(sno_store_header_t)));
+    assert(count == 3 && memcmp(loaded, set, sizeof set) == 0);
+
+    view_t s = bind("POST /api x");
+    assert(pat(&s, &loaded[0]) && *s.begin == ' ');
+    s = bind("3.14");
+    assert(pat(&s, &loaded[1]) && s.begin == s.end);
+
+    // Buffer too small for the file
+    assert(sno_store_load(file, image, sizeof image / 2, &count) == NULL);
+    assert(sno_store_load("nofile.001", image, sizeof image, &count) == NULL);
+    remove(file);
+}
+
+void test_sno_store_reject(void) {
+    static sno_pattern_t set[1];
+    static uint16_t image[(sizeof(sno_store_header_t) + sizeof set) / 2];
+    sno_store_header_t* h = (sno_store_header_t*)image;
+    sno_pattern_t* p = (sno_pattern_t*)(h + 1);
+    uint16_t count = 0;
+
+    assert(sno_regex(&set[0], "[ab]|c", NULL) && set[0].pool_used == 3);
+    memcpy(h->magic, SNO_STORE_MAGIC, 4);
+    h->version = SNO_STORE_VERSION;
+    h->count = 1;
+    h->prog = SNO_PATTERN_PROG;
+    h->pool = SNO_PATTERN_POOL;
+    *p = set[0];
+    assert(sno_store_map(image, sizeof image, &count) == p && count == 1);
+
+    // Header damage
+    h->magic[0] = 'X';
+    assert(!sno_store_map(image, sizeof image, &count));
+    h->magic[0] = 'S';
+    h->pool = SNO_PATTERN_POOL / 2;
+    assert(!sno_store_map(image, sizeof image, &count));
+    h->pool = SNO_PATTERN_POOL;
+    assert(!sno_store_map(image, sizeof image - 1, &count));
+
+    // Program damage is caught before anything runs it
+    p->prog[0].arg = p->count;          // jump out of the program
+    assert(!sno_store_map(image, sizeof image, &count));
+    *p = set[0];
+    p->prog[1].op = 0xEE;               // unknown opcode
+    assert(!sno_store_map(image, sizeof image, &count));
+    *p = set[0];
+    p->pool[p->pool_used - 1] = 'x';    // unterminated pool
+    assert(!sno_store_map(image, sizeof image, &count));
+    *p = set[0];
+    p->prog[0].op = SNO_OP_JMP;         // 0: JMP 0 would never end
+    p->prog[0].arg = 0;
+    assert(!sno_store_map(image, sizeof image, &count));
+    *p = set[0];
+    p->prog[p->count - 1].op = SNO_OP_CHOICE;   // back to the start: a cycle without progress
+    p->prog[p->count - 1].arg = 0;
+    assert(!sno_store_map(image, sizeof image, &count));
+    {
+        // Each LOOP pops a choice of another loop: forward and backward checks pass, the run is exponential
+        static const uint8_t loops[][2] = {
+            {SNO_OP_CHOICE, 3}, {SNO_OP_LOOP, 0}, {SNO_OP_CHOICE, 8}, {SNO_OP_LOOP, 6}, {SNO_OP_CHOICE, 5},
+            {SNO_OP_CHOICE, 6}, {SNO_OP_CHR, 'a'}, {SNO_OP_JMP, 8}, {SNO_OP_LOOP, 2}
+        };
+        sno_pattern_init(p);
+        for (unsigned int i = 0; i < sizeof loops / sizeof loops[0]; i++)
+            sno_pattern_emit(p, (sno_opcode_t)loops[i][0], loops[i][1]);
+        assert(!sno_pattern_check(p) && !sno_store_map(image, sizeof image, &count));
+    }
+    *p = set[0];
+    p->prog[p->count - 2].op = SNO_OP_LOOP;     // a loop with no CHOICE of its own
+    p->prog[p->count - 2].arg = 0;
+    assert(!sno_store_map(image, sizeof image, &count));
+    *p = set[0];
+    assert(sno_store_map(image, sizeof image, &count) == p);
+    assert(sno_regex(&set[0], "(ab)*c|(a*)*b", NULL) && sno_pattern_check(&set[0]));     // loops jump back
+
+    // NULL safety
+    assert(!sno_store_map(NULL, sizeof image, &count));
+    assert(!sno_store_map(image, sizeof image, NULL));
+    assert(!sno_store_save(NULL, set, 1));
+    assert(!sno_store_save("snopat.002", NULL, 1));
+}
+
+void test_sno_store(void) {
+    test_sno_store_roundtrip();
+    test_sno_store_reject();
+    printf("All pattern serialization tests pass!\n");
+}
+
+#endif
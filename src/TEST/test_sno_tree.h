@@ -0,0 +1,147 @@
+/**
+ * @file test_sno_tree.h
+ * @brief Tests for SNOBOL4-C parse tree builder
+ *
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file
+ */
+#ifndef TEST_SNO_TREE_H
+#define TEST_SNO_TREE_H
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_constants.h"
+#include "../SNO/sno_tree.h"
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+
+enum { T_ROOT, T_EXPR, T_PAREN, T_NUM, T_OP };
+
+static bool test_expr(view_t* s, sno_tree_t* t);
+
+// term := '(' expr ')' | digits   (paren tried first to exercise rollback)
+static bool test_term(view_t* s, sno_tree_t* t) {
+    sno_mark_t m = sno_tree_mark(t, s);
+    if ((sno_tree_open(t, T_PAREN, s->begin) != SNO_TREE_NIL &&
+         chr(s, '(') && test_expr(s, t) && chr(s, ')') &&
+         sno_tree_close(t, s->begin)) || sno_tree_rollback(t, m, s))
+        return true;
+
+    cursor_t p = s->begin;
+    return span(s, SNO_DIGITS) && cap(t, T_NUM, p, s);
+}
+
+// expr := term (op term)*
+static bool test_expr(view_t* s, sno_tree_t* t) {
+    sno_mark_t m = sno_tree_mark(t, s);
+    if (sno_tree_open(t, T_EXPR, s->begin) == SNO_TREE_NIL || !test_term(s, t))
+        return sno_tree_rollback(t, m, s);
+
+    for (;;) {
+        sno_mark_t more = sno_tree_mark(t, s);
+        cursor_t p = s->begin;
+        if (!(any(s, "+-") && cap(t, T_OP, p, s) && test_term(s, t))) {
+            sno_tree_rollback(t, more, s);  // drop a dangling operator
+            break;
+        }
+    }
+    return sno_tree_close(t, s->begin);
+}
+
+static unsigned int test_children(const sno_tree_t* t, uint16_t n) {
+    unsigned int k = 0;
+    for (uint16_t c = t->nodes[n].child; c != SNO_TREE_NIL; c = t->nodes[c].sibling) k++;
+    return k;
+}
+
+static bool test_span_is(const sno_tree_t* t, uint16_t n, const char* text) {
+    view_t v = t->nodes[n].span;
+    return size(v) == strlen(text) && strncmp(v.begin, text, size(v)) == 0;
+}
+
+void test_sno_tree_build(void) {
+    sno_node_t nodes[32];
+    sno_tree_t t;
+    view_t s = bind("1+(20-3)");
+
+    assert(sno_tree_init(&t, nodes, 32, T_ROOT, s));
+    assert(test_expr(&s, &t) && s.begin == s.end);
+
+    // Pre-order array: ROOT EXPR NUM OP PAREN EXPR NUM OP NUM
+    static const uint16_t kinds[] = {T_ROOT, T_EXPR, T_NUM, T_OP, T_PAREN, T_EXPR, T_NUM, T_OP, T_NUM};
+    assert(t.count == 9);
+    for (uint16_t i = 0; i < t.count; i++) assert(nodes[i].kind == kinds[i]);
+
+    // Links and zero-copy spans
+    assert(test_children(&t, 0) == 1 && test_children(&t, 1) == 3 && test_children(&t, 5) == 3);
+    assert(test_span_is(&t, 1, "1+(20-3)"));
+    assert(test_span_is(&t, 4, "(20-3)"));
+    assert(test_span_is(&t, 5, "20-3"));
+    assert(test_span_is(&t, 6, "20"));
+    assert(nodes[4].child == 5 && nodes[5].sibling == SNO_TREE_NIL);
+    assert(nodes[8].sibling == SNO_TREE_NIL && nodes[8].child == SNO_TREE_NIL);
+
+    // Failed paren attempts left no nodes behind: every NUM is reachable
+    unsigned int nums = 0;
+    for (uint16_t i = 0; i < t.count; i++) nums += nodes[i].kind == T_NUM;
+    assert(nums == 3);
+
+    // Dangling operator is rolled back with its node
+    s = bind("7+");
+    assert(sno_tree_init(&t, nodes, 32, T_ROOT, s));
+    assert(test_expr(&s, &t) && *s.begin == '+' && t.count == 3);
+    assert(test_children(&t, 1) == 1 && test_span_is(&t, 1, "7"));
+}
+
+void test_sno_tree_rollback(void) {
+    sno_node_t nodes[8];
+    sno_tree_t t;
+    view_t s = bind("abc");
+    assert(sno_tree_init(&t, nodes, 8, T_ROOT, s));
+
+    // Rollback of the first child clears the parent's child link
+    sno_mark_t m = sno_tree_mark(&t, &s);
+    assert(sno_tree_open(&t, T_EXPR, s.begin) == 1 && len(&s, 2));
+    assert(!sno_tree_rollback(&t, m, &s));
+    assert(t.count == 1 && t.depth == 1 && nodes[0].child == SNO_TREE_NIL && s.begin == m.cursor);
+
+    // Rollback of a later sibling clears the previous sibling's link
+    assert(sno_tree_leaf(&t, T_NUM, view(s.begin, s.begin + 1)) == 1);
+    m = sno_tree_mark(&t, NULL);
+    assert(sno_tree_leaf(&t, T_NUM, view(s.begin + 1, s.begin + 2)) == 2);
+    assert(sno_tree_leaf(&t, T_NUM, view(s.begin + 2, s.begin + 3)) == 3);
+    sno_tree_rollback(&t, m, NULL);
+    assert(t.count == 2 && nodes[1].sibling == SNO_TREE_NIL);
+
+    // Appending after rollback reuses the slots
+    assert(sno_tree_leaf(&t, T_OP, view(s.begin, s.begin)) == 2 && nodes[1].sibling == 2);
+
+    // Capacity and nesting limits
+    sno_node_t small[2];
+    assert(sno_tree_init(&t, small, 2, T_ROOT, s));
+    assert(sno_tree_leaf(&t, T_NUM, s) == 1);
+    assert(sno_tree_leaf(&t, T_NUM, s) == SNO_TREE_NIL);
+    assert(sno_tree_open(&t, T_EXPR, s.begin) == SNO_TREE_NIL && t.depth == 1);
+
+    // Closing root leaves nothing open
+    assert(sno_tree_close(&t, s.end) && t.depth == 0);
+    assert(!sno_tree_close(&t, s.end));
+    assert(sno_tree_leaf(&t, T_NUM, s) == SNO_TREE_NIL);
+
+    // NULL safety
+    assert(!sno_tree_init(NULL, nodes, 8, T_ROOT, s));
+    assert(!sno_tree_init(&t, NULL, 8, T_ROOT, s));
+    assert(!sno_tree_init(&t, nodes, 0, T_ROOT, s));
+    assert(sno_tree_open(NULL, T_EXPR, s.begin) == SNO_TREE_NIL);
+    assert(!sno_tree_close(NULL, s.end));
+    assert(!cap(NULL, T_NUM, s.begin, &s));
+    assert(!cap(&t, T_NUM, s.begin, NULL));
+}
+
+void test_sno_tree(void) {
+    test_sno_tree_build();
+    test_sno_tree_rollback();
+    printf("All parse tree builder tests pass!\n");
+}
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file test_sno_utf8.h
+ * @brief Tests for SNOBOL4-C UTF-8 code point primitives
+ *
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file
+ */
+#ifndef TEST_SNO_UTF8_H
+#define TEST_SNO_UTF8_H
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_utf8.h"
+#include <assert.h>
+#include <stdio.h>
+
+// "naïve café – 東京 😀"
+#define TEST_UTF8_TEXT "na\xC3\xAFve caf\xC3\xA9 \xE2\x80\x93 \xE6\x9D\xB1\xE4\xBA\xAC \xF0\x9F\x98\x80"
+
+void test_sno_utf8_decode(void) {
+    static const struct { const char* bytes; unsigned int length; uint32_t cp; } cases[] = {
+        {"A",                   1, 0x41},
+        {"\xC3\xA9",            2, 0xE9},
+        {"\xE2\x80\x93",        3, 0x2013},
+        {"\xF0\x9F\x98\x80",    4, 0x1F600},
+        {"\xF4\x8F\xBF\xBF",    4, 0x10FFFF},
+        {"\xC0\xAF",            0, 0},      // overlong '/'
+        {"\xE0\x80\xAF",        0, 0},      // overlong '/'
+        {"\xED\xA0\x80",        0, 0},      // surrogate D800
+        {"\xF4\x90\x80\x80",    0, 0},      // past U+10FFFF
+        {"\x80",                0, 0},      // stray continuation
+        {"\xE6\x9D",            0, 0},      // truncated
+        {"\xC3(",               0, 0},      // bad continuation
+    };
+    for (unsigned int i = 0; i < sizeof cases / sizeof cases[0]; i++) {
+        uint32_t cp = 0;
+        assert(sno_utf8_decode(bind(cases[i].bytes), &cp) == cases[i].length);
+        if (cases[i].length) assert(cp == cases[i].cp);
+    }
+    assert(sno_utf8_decode(bind(""), NULL) == 0);
+
+    assert(usize(bind(TEST_UTF8_TEXT)) == 17);
+    assert(usize(bind("plain ascii text that is longer than a word")) == 43);
+    assert(usize(bind("abcdefgh\xE6\x9D")) == 0);    // invalid after an ASCII word
+    assert(usize(bind("")) == 0);
+}
+
+void test_sno_utf8_ulen(void) {
+    view_t s = bind(TEST_UTF8_TEXT);
+
+    // Never splits a character
+    assert(ulen(&s, 3) && size(view(s.begin - 4, s.begin)) == 4);     // "naï" is 4 bytes
+    assert(ulen(&s, 14) && s.begin == s.end);
+    s = bind(TEST_UTF8_TEXT);
+    assert(!ulen(&s, 18) && str(&s, "na"));         // too short: cursor unchanged
+
+    // ASCII words then multi-byte characters
+    s = bind("0123456789abcdef\xC3\xA9!");
+    assert(ulen(&s, 17) && *s.begin == '!');
+    s = bind("0123456789abcdef\xC3");
+    cursor_t start = s.begin;
+    assert(!ulen(&s, 17) && s.begin == start);
+    assert(ulen(&s, 0) && s.begin == start);
+    assert(!ulen(NULL, 1));
+}
+
+void test_sno_utf8_sets(void) {
+    static const sno_urange_t letters[] = {
+        {'a', 'z'}, {'A', 'Z'}, {0xC0, 0x24F}, {0x4E00, 0x9FFF},     // Latin, Latin-1/Extended, CJK
+    };
+    static const sno_urange_t dash[] = {{'-', '-'}, {0x2010, 0x2015}};
+    sno_uset_t word, dashes;
+
+    assert(sno_uset_init(&word, letters, 4) && word.count == 2);
+    assert(sno_uset_init(&dashes, dash, 2) && dashes.count == 1);
+
+    view_t s = bind(TEST_UTF8_TEXT);
+    assert(uspan(&s, &word) && str(&s, " "));       // "naïve"
+    assert(uspan(&s, &word) && str(&s, " "));       // "café"
+    assert(!uspan(&s, &word) && uany(&s, &dashes) && str(&s, " "));
+    cursor_t kyoto = s.begin;
+    assert(uspan(&s, &word) && size(view(kyoto, s.begin)) == 6 && str(&s, " "));
+    assert(!uany(&s, &word) && ulen(&s, 1) && s.begin == s.end);
+    assert(!uany(&s, &word) && !uspan(&s, &word));  // empty subject
+
+    // Long ASCII runs go through the word path, ending mid word or at a multi-byte member
+    s = bind("abcdefghijklmnopqrstu\xC3\xA9xyz 1");
+    assert(uspan(&s, &word) && *s.begin == ' ');
+    s = bind("abcdefghijklmno5");
+    assert(uspan(&s, &word) && *s.begin == '5');
+
+    // A range straddling ASCII splits into bitmap and range
+    static const sno_urange_t wide[] = {{0x70, 0x100}};
+    assert(sno_uset_init(&word, wide, 1) && word.count == 1 && word.ranges[0].lo == 0x80);
+    s = bind("xyz\xC3\xBF\xC4\x80\xC4\x81");
+    assert(uspan(&s, &word) && size(s) == 2);
+
+    // Invalid input stops a span and fails uany
+    s = bind("ab\xFF");
+    assert(uspan(&s, &word) == false);              // 'a' < 0x70
+    static const sno_urange_t all[] = {{0, SNO_UTF8_MAX}};
+    assert(sno_uset_init(&word, all, 1));
+    assert(uspan(&s, &word) && size(s) == 1 && !uany(&s, &word));
+
+    // Bad sets and NULL safety
+    static const sno_urange_t backwards[] = {{'z', 'a'}};
+    static const sno_urange_t huge[] = {{0, 0x110000UL}};
+    sno_urange_t many[SNO_USET_RANGES + 1];
+    for (unsigned int i = 0; i <= SNO_USET_RANGES; i++) many[i].lo = many[i].hi = 0x100 + 2 * i;
+    assert(!sno_uset_init(&word, backwards, 1));
+    assert(!sno_uset_init(&word, huge, 1));
+    assert(!sno_uset_init(&word, many, SNO_USET_RANGES + 1));
+    assert(sno_uset_init(&word, many, SNO_USET_RANGES));
+    assert(!sno_uset_init(NULL, all, 1) && !sno_uset_init(&word, NULL, 1));
+    assert(!uany(NULL, &word) && !uany(&s, NULL) && !uspan(NULL, &word) && !uspan(&s, NULL));
+}
+
+void test_sno_utf8(void) {
+    test_sno_utf8_decode();
+    test_sno_utf8_ulen();
+    test_sno_utf8_sets();
+    printf("All UTF-8 primitive tests pass!\n");
+}
+
+#endif
@@ -153,7 +153,7 @@ void test_printf_error_conditions() {
 
 void test_fputc_file_ops(void) {
     // Test character output to stdout (handle 1)
-    FILE* stdout_handle = (FILE*)(uintptr_t)1;
+    FILE* stdout_handle = stdout;
     fputc('A', stdout_handle);
     fputc('B', stdout_handle);
     fputc('\n', stdout_handle);
@@ -175,7 +175,7 @@ void test_fputs_file_ops(void) {
     printf("Testing fputs file operations...\n");
 
     // Test string output to stdout (handle 1)
-    FILE* stdout_handle = (FILE*)(uintptr_t)1;
+    FILE* stdout_handle = stdout;
     fputs("Hello from fputs\n", stdout_handle);
 
     // Test empty string
@@ -334,6 +334,83 @@ void test_perror_strerror() {
     printf("perror/strerror test complete n\n");
 }
 
+void test_sprintf_snprintf(void) {
+    char buf[TEST_BUF_SIZE];
+
+    // Same formatter as printf, into memory
+    assert(sprintf(buf, "%d %u %x %X %o %c %s %%", -42, 42u, 255u, 255u, 8u, 'z', "str") == 23);
+    assert(strcmp(buf, "-42 42 ff FF 10 z str %") == 0);
+    assert(sprintf(buf, "%ld %lu", -100000L, 4000000000UL) == 18);
+    assert(strcmp(buf, "-100000 4000000000") == 0);
+
+    // Truncation: always terminated, returns the full length
+    assert(snprintf(buf, 6, "%s", "truncated") == 9);
+    assert(strcmp(buf, "trunc") == 0);
+    assert(snprintf(buf, 1, "%d", 123) == 3 && buf[0] == '\0');
+    assert(snprintf(NULL, 0, "%d-%d", 10, 20) == 5);
+
+    // Width, flags and precision
+    assert(sprintf(buf, "[%5d|%-5d|%05d|%+d|%.3d|%8.3d]", 42, 42, -42, 42, 7, -7) == 36);
+    assert(strcmp(buf, "[   42|42   |-0042|+42|007|    -007]") == 0);
+    assert(sprintf(buf, "[%#x|%08lX|%#o|%.0d]", 255u, 0xBEEFUL, 8u, 0) == 20);
+    assert(strcmp(buf, "[0xff|0000BEEF|010|]") == 0);
+    assert(sprintf(buf, "[%6s|%-6s|%.2s|%*d]", "ab", "ab", "abc", 4, 9) == 23);
+    assert(strcmp(buf, "[    ab|ab    |ab|   9]") == 0);
+    assert(sprintf(buf, "%lu %ld", 4294967295UL, -2147483647L - 1) == 22);
+    assert(strcmp(buf, "4294967295 -2147483648") == 0);
+
+    // Trailing '%' is copied
+    assert(sprintf(buf, "100%") == 4 && strcmp(buf, "100%") == 0);
+
+    printf("sprintf/snprintf test passed\n\n");
+}
+
+#ifdef POLICY_USE_DOSLIBC
+void test_console_raw(void) {
+    uint16_t info = 0;
+    assert(dos_get_device_info(1, &info) == 0);
+    if (!(info & DOS_DEV_CHAR) || (info & DOS_DEV_BINARY)) {
+        printf("stdout is not a cooked console, raw mode test skipped\n\n");
+        return;
+    }
+
+    // A long write switches the console to raw and leaves it there
+    printf("%s\n", "Raw console output: this line is longer than DOS_STDIO_RAW_MIN bytes.");
+    assert(dos_get_device_info(1, &info) == 0 && (info & DOS_DEV_BINARY));
+    printf("Short line, still raw\n");
+    assert(dos_get_device_info(1, &info) == 0 && (info & DOS_DEV_BINARY));
+
+    // Tabs and stderr go out cooked
+    printf("\tTabbed line, long enough to be a bulk write but expanded by cooked DOS\n");
+    assert(dos_get_device_info(1, &info) == 0 && !(info & DOS_DEV_BINARY));
+    printf("%s\n", "Raw console output again: this line is longer than DOS_STDIO_RAW_MIN.");
+    fputs("stderr line\n", stderr);
+    assert(dos_get_device_info(1, &info) == 0 && !(info & DOS_DEV_BINARY));
+
+    printf("Console raw mode test passed\n\n");
+}
+
+static char     test_console_seen[32];
+static uint16_t test_console_len;
+
+static void test_console_capture(void* ctx, const char* s, uint16_t n) {
+    (void)ctx;
+    while (n-- && test_console_len < sizeof(test_console_seen) - 1) test_console_seen[test_console_len++] = *s++;
+}
+
+void test_console_writer(void) {
+    if (dos_stdio_set_console(test_console_capture, NULL) != 0) {
+        assert(errno == ENODEV);
+        printf("stdout is not the console, console writer test skipped\n\n");
+        return;
+    }
+    printf("ab\n");
+    fputs("c", stderr);
+    assert(dos_stdio_set_console(NULL, NULL) == 0);
+    assert(memcmp(test_console_seen, "ab\r\nc", 5) == 0 && test_console_len == 5);
+    printf("Console writer test passed\n\n");
+}
+#endif
 
 void test_fgets_stdin(void) {
     char buf[TEST_BUF_SIZE];
@@ -375,8 +452,16 @@ void test_stdio() {
     test_printf_float_edge_cases();
     getchar();
     #endif
+    test_sprintf_snprintf();
+    getchar();
     test_perror_strerror();
     getchar();
+    #ifdef POLICY_USE_DOSLIBC
+    test_console_raw();
+    getchar();
+    test_console_writer();
+    getchar();
+    #endif
     test_fgets_stdin();
 
 }
@@ -0,0 +1,75 @@
+#!/bin/sh
+# @file bench_sno_grep.sh
+# @brief Benchmark: sno_grep against GNU grep -E on a synthetic log corpus (host tool)
+#
+# Builds sno_grep, writes FILES log files of LINES lines each into a
+# scratch directory, then times `sno_grep -c` and `grep -E -r -c` per
+# pattern (best of ROUNDS) and checks that both count the same lines.
+# The patterns keep possessive SNO and POSIX semantics in agreement.
+#
+# Usage:   ./bench_sno_grep.sh [files] [lines]      (defaults 64 x 100000, about 250 MB)
+#
+# @author Jeremy Simon Thornton
+# @copyright Copyright (c) 2026 Jeremy Simon Thornton
+# @license MIT License — see LICENSE file for full terms
+
+set -e
+FILES=${1:-64}
+LINES=${2:-100000}
+ROUNDS=3
+HERE=$(cd "$(dirname "$0")" && pwd)
+WORK=${TMPDIR:-/tmp}/bench_sno_grep.$$
+trap 'rm -rf "$WORK"' EXIT INT TERM
+mkdir -p "$WORK/corpus"
+
+cc -O2 -pthread -I"$HERE/../SNO" -o "$WORK/sno_grep" "$HERE/sno_grep.c" "$HERE/../SNO/sno_regex.c" \
+   "$HERE/../SNO/sno_optimize.c" "$HERE/../SNO/sno_pattern.c" "$HERE/../SNO/sno_core.c"
+
+# Same mix of lines as bench_sno_regex.c
+i=0
+while [ $i -lt "$FILES" ]; do
+    awk -v n="$LINES" -v seed=$i 'BEGIN {
+        srand(seed + 2026)
+        split("GET POST PUT DELETE PATCH", verb, " ")
+        for (k = 0; k < n; k++) {
+            w = ""; for (j = 3 + int(rand() * 8); j > 0; j--) w = w sprintf("%c", 97 + int(rand() * 26))
+            r = int(rand() * 5)
+            if (r == 0)      printf "%s /%s/%s %d\n", verb[1 + int(rand() * 5)], w, substr(w, 2), 200 + int(rand() * 300)
+            else if (r == 1) printf "%d.%d.%d.%d - %s\n", rand() * 256, rand() * 256, rand() * 256, rand() * 256, w
+            else if (r == 2) printf "%s=%d %s\n", w, rand() * 100000, substr(w, 3)
+            else if (r == 3) printf "%s: connection %s after %d ms\n", rand() < 0.5 ? "ERROR" : "INFO", rand() < 0.5 ? "timeout" : "refused", rand() * 5000
+            else             printf "%s %s %s %d\n", w, substr(w, 2), substr(w, 4), rand() * 1000
+        }
+    }' > "$WORK/corpus/log$i.txt"
+    i=$((i + 1))
+done
+echo "$FILES files x $LINES lines, $(du -sh "$WORK/corpus" | cut -f1), $(nproc) cores, best of $ROUNDS, seconds"
+printf "\n%-40s %10s %8s %8s %8s\n" "pattern" "lines" "sno" "grep" "grep/sno"
+
+best() {    # best wall time of ROUNDS runs of "$@", output to $WORK/out
+    b=""
+    r=0
+    while [ $r -lt $ROUNDS ]; do
+        s=$(date +%s.%N)
+        "$@" > "$WORK/out" || true
+        e=$(date +%s.%N)
+        b=$(awk -v s="$s" -v e="$e" -v b="$b" 'BEGIN { t = e - s; print (b == "" || t < b) ? t : b }')
+        r=$((r + 1))
+    done
+    echo "$b"
+}
+
+total() {
+    awk -F: '{ s += $NF } END { print s + 0 }' "$WORK/out"
+}
+
+status=0
+for p in 'ERROR' 'timeout|refused' '(GET|POST) /[a-z]+' '[0-9]+\.[0-9]+\.[0-9]+\.[0-9]+ ' \
+         '^[a-z]+=[0-9]+ ' '[a-z]+ [a-z]+ [a-z]+ [0-9]+$' 'after [0-9][0-9][0-9][0-9] ms'; do
+    ts=$(best "$WORK/sno_grep" -c "$p" "$WORK/corpus"); ns=$(total)
+    tg=$(best grep -E -r -c "$p" "$WORK/corpus"); ng=$(total)
+    flag=""
+    [ "$ns" = "$ng" ] || { flag="  MISMATCH ($ng)"; status=1; }
+    printf "%-40s %10s %8.3f %8.3f %7.2fx%s\n" "$p" "$ns" "$ts" "$tg" "$(echo "$tg $ts" | awk '{ print $1 / $2 }')" "$flag"
+done
+exit $status
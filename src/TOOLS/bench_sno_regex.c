@@ -0,0 +1,178 @@
+/**
+ * @file bench_sno_regex.c
+ * @brief Benchmark: sno_regex() compiled patterns against POSIX regexec (host tool)
+ *
+ * Builds a synthetic log of LINES lines and matches every line, anchored at
+ * its start, with each pattern through pat() as compiled, pat() after
+ * sno_optimize() (before/after) and regexec(). The patterns are chosen so
+ * possessive / ordered SNO semantics and POSIX leftmost-longest semantics
+ * agree on match vs no match; the tool checks that.
+ *
+ * Usage:   bench_sno_regex [lines]
+ * Build:   cc -O2 -I../SNO -o bench_sno_regex bench_sno_regex.c ../SNO/sno_regex.c ../SNO/sno_optimize.c \
+ *                ../SNO/sno_pattern.c ../SNO/sno_core.c
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <regex.h>
+
+#include "../SNO/sno_core.h"
+#include "../SNO/sno_regex.h"
+#include "../SNO/sno_optimize.h"
+
+#define LINES   200000
+#define ROUNDS  5
+
+static const char* const patterns[] = {
+    "(GET|POST|PUT|DELETE) /[a-z0-9/]*",
+    "[0-9]+\\.[0-9]+\\.[0-9]+\\.[0-9]+ ",
+    "[A-Za-z_][A-Za-z0-9_]*=[^ ]* ",
+    "(ERROR|WARN):",
+    "[a-z]+ [a-z]+ [a-z]+ [0-9]+$",
+    "(a|b|c|d|e|f)[a-z]*[a-z]*=",
+    "([0-9]+)?(\\.[0-9]+)?(\\.[0-9]+)?\\.[0-9]+ - ",
+};
+
+static unsigned long seed = 2026;
+
+static unsigned int rnd(unsigned int n) {
+    seed = seed * 1103515245UL + 12345UL;
+    return (unsigned int)((seed >> 16) % n);
+}
+
+static char* word(char* p, unsigned int lo, unsigned int hi) {
+    unsigned int n = lo + rnd(hi - lo + 1);
+    while (n--) *p++ = (char)('a' + rnd(26));
+    return p;
+}
+
+// One line of a mixed log, returns the end of the line (no newline written)
+static char* line(char* p) {
+    static const char* const verbs[] = {"GET", "POST", "PUT", "DELETE", "PATCH"};
+    switch (rnd(5)) {
+    case 0:
+        p += sprintf(p, "%s /", verbs[rnd(5)]);
+        p = word(p, 2, 8); *p++ = '/'; p = word(p, 1, 10);
+        p += sprintf(p, " %u", 200 + rnd(300));
+        break;
+    case 1:
+        p += sprintf(p, "%u.%u.%u.%u - ", rnd(256), rnd(256), rnd(256), rnd(256));
+        p = word(p, 3, 12);
+        break;
+    case 2:
+        p = word(p, 3, 10);
+        p += sprintf(p, "=%u ", rnd(100000));
+        p = word(p, 3, 10);
+        break;
+    case 3:
+        p += sprintf(p, "%s: ", rnd(2) ? "ERROR" : "INFO");
+        p = word(p, 5, 30);
+        break;
+    default:
+        for (int i = 0; i < 3; i++) { p = word(p, 1, 7); *p++ = ' '; }
+        p += sprintf(p, "%u", rnd(1000));
+        if (rnd(4) == 0) *p++ = '.';
+        break;
+    }
+    return p;
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char* argv[]) {
+    unsigned long lines = argc > 1 ? strtoul(argv[1], NULL, 10) : LINES;
+    if (lines == 0) lines = LINES;
+
+    // Newline separated text for SNO, NUL separated copy for regexec
+    char* text = malloc(lines * 64);
+    char* ctext = malloc(lines * 64);
+    cursor_t* starts = malloc((lines + 1) * sizeof *starts);
+    if (!text || !ctext || !starts) return 1;
+
+    char* p = text;
+    for (unsigned long i = 0; i < lines; i++) {
+        starts[i] = p;
+        p = line(p);
+        *p++ = '\n';
+    }
+    starts[lines] = p;
+    memcpy(ctext, text, (size_t)(p - text));
+    for (char* q = ctext; q < ctext + (p - text); q++) if (*q == '\n') *q = '\0';
+
+    printf("%lu lines, %lu bytes, best of %d rounds, ns per line\n\n", lines, (unsigned long)(p - text), ROUNDS);
+    printf("%-40s %8s %6s %8s %8s %8s %8s\n", "pattern", "matches", "insts", "sno", "opt", "posix", "opt/posix");
+
+    int status = 0;
+    for (unsigned int k = 0; k < sizeof patterns / sizeof patterns[0]; k++) {
+        sno_pattern_t sp;
+        const char* error;
+        if (!sno_regex(&sp, patterns[k], &error)) {
+            fprintf(stderr, "sno_regex: error at '%s' in %s\n", error, patterns[k]);
+            return 1;
+        }
+
+        sno_pattern_t op = sp;
+        int rewrites = sno_optimize(&op);
+
+        char anchored[256];
+        regex_t rp;
+        snprintf(anchored, sizeof anchored, "^(%s)", patterns[k]);
+        if (regcomp(&rp, anchored, REG_EXTENDED | REG_NOSUB) != 0) {
+            fprintf(stderr, "regcomp failed: %s\n", anchored);
+            return 1;
+        }
+
+        double best_sno = 1e9, best_opt = 1e9, best_posix = 1e9;
+        unsigned long hits_sno = 0, hits_opt = 0, hits_posix = 0;
+        for (int r = 0; r < ROUNDS; r++) {
+            double t = now();
+            hits_sno = 0;
+            for (unsigned long i = 0; i < lines; i++) {
+                view_t s = view(starts[i], starts[i + 1] - 1);
+                hits_sno += pat(&s, &sp);
+            }
+            t = now() - t;
+            if (t < best_sno) best_sno = t;
+
+            t = now();
+            hits_opt = 0;
+            for (unsigned long i = 0; i < lines; i++) {
+                view_t s = view(starts[i], starts[i + 1] - 1);
+                hits_opt += pat(&s, &op);
+            }
+            t = now() - t;
+            if (t < best_opt) best_opt = t;
+
+            t = now();
+            hits_posix = 0;
+            for (unsigned long i = 0; i < lines; i++)
+                hits_posix += regexec(&rp, ctext + (starts[i] - text), 0, NULL, 0) == 0;
+            t = now() - t;
+            if (t < best_posix) best_posix = t;
+        }
+        regfree(&rp);
+
+        bool agree = hits_sno == hits_posix && hits_opt == hits_posix;
+        printf("%-40s %8lu %2u->%-2u %8.1f %8.1f %8.1f %8.1fx%s\n", patterns[k], hits_sno,
+               sp.count, op.count, best_sno * 1e9 / lines, best_opt * 1e9 / lines,
+               best_posix * 1e9 / lines, best_posix / best_opt, agree ? "" : "  MISMATCH");
+        if (!agree || rewrites < 0) status = 1;
+    }
+
+    free(starts);
+    free(ctext);
+    free(text);
+    return status;
+}
@@ -0,0 +1,353 @@
+/**
+ * @file sno_grep.c
+ * @brief Parallel grep: search files and directories with SNO patterns (host tool)
+ *
+ * The pattern is written in the sno_regex() subset, compiled once and run
+ * through sno_optimize(). Every file is one task: worker threads (one per
+ * core by default) take the next task from a shared counter, search the
+ * memory-mapped file and format their output into a per-task buffer; the
+ * main thread prints the buffers in command-line order, so the output is
+ * the same for any number of workers.
+ *
+ * Search is unanchored and line based: candidate positions come from a
+ * prefilter (memmem() for a leading literal, memchr() for a single first
+ * byte, the first-byte set otherwise) and the compiled pattern only runs
+ * on the line holding a candidate, with '^' bound to the line start. A
+ * pattern starting with '^' runs once per candidate line; one starting with
+ * a span skips the rest of a run after a failed attempt (the span is
+ * possessive, so a later start in the run ends up in the same place).
+ *
+ * Usage:   sno_grep [-c] [-l] [-n] [-j threads] regex path...
+ *          directories are searched recursively, in name order; symbolic links
+ *          inside them are skipped
+ *          exit status 0 if a line matched, 1 if none, 2 on error (as grep)
+ * Build:   cc -O2 -pthread -I../SNO -o sno_grep sno_grep.c ../SNO/sno_regex.c ../SNO/sno_optimize.c \
+ *                ../SNO/sno_pattern.c ../SNO/sno_core.c
+ * Bench:   ./bench_sno_grep.sh (against GNU grep -E)
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#define _GNU_SOURCE     // memmem()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Not sno_core.h: its brk() clashes with the one in unistd.h (sno_core.c is still linked)
+#include "../SNO/sno_regex.h"
+#include "../SNO/sno_optimize.h"
+
+#define MAX_THREADS 64
+
+typedef struct {
+    char*         path;
+    char*         out;          // formatted output of this file
+    size_t        len;
+    size_t        cap;
+    unsigned long matches;
+    bool          failed;
+    bool          done;
+} task_t;
+
+static sno_pattern_t pattern;
+static uint8_t       first[32];         // bytes that can start a match
+static bool          filtered;          // false: a match may be empty or start with anything
+static int           lead = -1;         // the only first byte, if there is one
+static const char*   literal;           // text every match starts with, if any
+static size_t        literal_len;
+static uint8_t       run[32];           // set of a leading possessive span
+static bool          leading_span;
+static bool          anchored;          // starts with '^': only the line start can match
+
+static bool opt_count, opt_list, opt_number, with_name;
+
+static task_t*         tasks;
+static size_t          ntasks, tasks_cap;
+static size_t          next_task;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  finished = PTHREAD_COND_INITIALIZER;
+
+static void* xrealloc(void* p, size_t n) {
+    p = realloc(p, n);
+    if (!p) {
+        fprintf(stderr, "sno_grep: out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+static void add_task(const char* path) {
+    if (ntasks == tasks_cap) {
+        tasks_cap = tasks_cap ? tasks_cap * 2 : 64;
+        tasks = xrealloc(tasks, tasks_cap * sizeof *tasks);
+    }
+    memset(&tasks[ntasks], 0, sizeof *tasks);
+    tasks[ntasks++].path = strdup(path);
+}
+
+// Files in argument order, directories expanded recursively in name order; symbolic links are
+// followed only when named on the command line (as grep -r), so a link loop cannot recurse
+static bool collect(const char* path, bool named) {
+    struct stat st;
+    if ((named ? stat(path, &st) : lstat(path, &st)) != 0) {
+        fprintf(stderr, "sno_grep: %s: cannot open\n", path);
+        return false;
+    }
+    if (!S_ISDIR(st.st_mode)) {
+        if (S_ISREG(st.st_mode)) add_task(path);
+        return true;
+    }
+
+    struct dirent** names;
+    int n = scandir(path, &names, NULL, alphasort);
+    if (n < 0) {
+        fprintf(stderr, "sno_grep: %s: cannot read directory\n", path);
+        return false;
+    }
+    bool ok = true;
+    for (int i = 0; i < n; i++) {
+        const char* name = names[i]->d_name;
+        if (strcmp(name, ".") != 0 && strcmp(name, "..") != 0) {
+            size_t len = strlen(path) + strlen(name) + 2;
+            char* child = xrealloc(NULL, len);
+            snprintf(child, len, "%s%s%s", path, path[strlen(path) - 1] == '/' ? "" : "/", name);
+            ok &= collect(child, false);
+            free(child);
+        }
+        free(names[i]);
+    }
+    free(names);
+    return ok;
+}
+
+static void append(task_t* t, const char* s, size_t n) {
+    if (t->len + n > t->cap) {
+        t->cap = (t->len + n) * 2 + 256;
+        t->out = xrealloc(t->out, t->cap);
+    }
+    memcpy(t->out + t->len, s, n);
+    t->len += n;
+}
+
+static void append_prefix(task_t* t, unsigned long line) {
+    char buf[32];
+    if (with_name) {
+        append(t, t->path, strlen(t->path));
+        append(t, ":", 1);
+    }
+    if (opt_number) append(t, buf, (size_t)snprintf(buf, sizeof buf, "%lu:", line));
+}
+
+// First position in [p, end) where a match can start, or end
+static cursor_t candidate(cursor_t p, cursor_t end) {
+    if (!filtered) return p;
+    if (literal) {
+        cursor_t q = memmem(p, (size_t)(end - p), literal, literal_len);
+        return q ? q : end;
+    }
+    if (lead >= 0) {
+        cursor_t q = memchr(p, lead, (size_t)(end - p));
+        return q ? q : end;
+    }
+    while (p < end && !(first[(unsigned char)*p >> 3] & (1u << ((unsigned char)*p & 7)))) p++;
+    return p;
+}
+
+// Does the line [bol, eol) hold a match starting at or after from?
+static bool line_matches(cursor_t bol, cursor_t eol, cursor_t from) {
+    if (anchored) {
+        view_t s = {bol, eol};
+        return sno_exec(&pattern, &s, bol);
+    }
+    for (cursor_t at = from; at <= eol; at++) {
+        at = candidate(at, eol);
+        if (at == eol && filtered) return false;     // a filtered match needs a byte
+        view_t s = {at, eol};
+        if (sno_exec(&pattern, &s, bol)) return true;
+
+        // A possessive span started later in the same run stops at the same place: it fails too
+        if (leading_span)
+            while (at + 1 < eol && (run[(unsigned char)at[1] >> 3] & (1u << ((unsigned char)at[1] & 7)))) at++;
+    }
+    return false;
+}
+
+static void search_text(task_t* t, cursor_t text, cursor_t end) {
+    cursor_t pos = text, counted = text;
+    unsigned long line = 1;
+
+    while (pos < end) {
+        cursor_t at = candidate(pos, end);
+        if (at == end && filtered) break;
+
+        cursor_t bol = at;
+        while (bol > pos && bol[-1] != '\n') bol--;
+        cursor_t eol = memchr(at, '\n', (size_t)(end - at));
+        if (!eol) eol = end;
+
+        if (line_matches(bol, eol, at)) {
+            t->matches++;
+            if (opt_list) break;
+            if (!opt_count) {
+                if (opt_number) {
+                    for (cursor_t q = counted; (q = memchr(q, '\n', (size_t)(bol - q))) != NULL; q++) line++;
+                    counted = bol;
+                }
+                append_prefix(t, line);
+                append(t, bol, (size_t)(eol - bol));
+                append(t, "\n", 1);
+            }
+        }
+        pos = eol < end ? eol + 1 : end;
+    }
+
+    if (opt_list && t->matches) {
+        append(t, t->path, strlen(t->path));
+        append(t, "\n", 1);
+    } else if (opt_count) {
+        char buf[32];
+        if (with_name) {
+            append(t, t->path, strlen(t->path));
+            append(t, ":", 1);
+        }
+        append(t, buf, (size_t)snprintf(buf, sizeof buf, "%lu\n", t->matches));
+    }
+}
+
+static void search_file(task_t* t) {
+    int fd = open(t->path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        t->failed = true;
+        if (fd >= 0) close(fd);
+        return;
+    }
+
+    if (st.st_size == 0) {
+        static const char empty[1];
+        search_text(t, empty, empty);
+    } else {
+        char* text = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (text == MAP_FAILED) {
+            t->failed = true;
+        } else {
+            madvise(text, (size_t)st.st_size, MADV_SEQUENTIAL);
+            search_text(t, text, text + st.st_size);
+            munmap(text, (size_t)st.st_size);
+        }
+    }
+    close(fd);
+}
+
+static void* worker(void* arg) {
+    (void)arg;
+    for (;;) {
+        pthread_mutex_lock(&lock);
+        size_t i = next_task++;
+        pthread_mutex_unlock(&lock);
+        if (i >= ntasks) return NULL;
+
+        search_file(&tasks[i]);
+
+        pthread_mutex_lock(&lock);
+        tasks[i].done = true;
+        pthread_cond_broadcast(&finished);
+        pthread_mutex_unlock(&lock);
+    }
+}
+
+static void prepare(void) {
+    anchored = pattern.prog[0].op == SNO_OP_BOL;
+    if (pattern.prog[0].op == SNO_OP_SPAN) {
+        leading_span = true;
+        for (const char* m = pattern.pool + pattern.prog[0].arg; *m; m++)
+            run[(unsigned char)*m >> 3] |= (uint8_t)(1u << ((unsigned char)*m & 7));
+    }
+
+    filtered = sno_pattern_first(&pattern, 0, pattern.count, first);
+    if (!filtered) return;
+
+    if (pattern.prog[0].op == SNO_OP_STR) {
+        literal = pattern.pool + pattern.prog[0].arg;
+        literal_len = strlen(literal);
+        return;
+    }
+    unsigned int members = 0;
+    for (unsigned int c = 0; c < 256; c++)
+        if (first[c >> 3] & (1u << (c & 7))) { members++; lead = (int)c; }
+    if (members != 1) lead = -1;
+}
+
+static int usage(void) {
+    fprintf(stderr, "usage: sno_grep [-c] [-l] [-n] [-j threads] regex path...\n");
+    return 2;
+}
+
+int main(int argc, char* argv[]) {
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    int c;
+    while ((c = getopt(argc, argv, "clnj:")) != -1) {
+        switch (c) {
+        case 'c': opt_count = true; break;
+        case 'l': opt_list = true; break;
+        case 'n': opt_number = true; break;
+        case 'j': threads = strtol(optarg, NULL, 10); break;
+        default:  return usage();
+        }
+    }
+    if (argc - optind < 2) return usage();
+    if (threads < 1) threads = 1;
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+
+    const char* error;
+    if (!sno_regex(&pattern, argv[optind], &error)) {
+        fprintf(stderr, "sno_grep: bad pattern at '%s'\n", error);
+        return 2;
+    }
+    if (sno_optimize(&pattern) < 0) return 2;
+    prepare();
+
+    bool ok = true;
+    for (int i = optind + 1; i < argc; i++) {
+        struct stat st;
+        if (argc - optind > 2 || (stat(argv[i], &st) == 0 && S_ISDIR(st.st_mode))) with_name = true;
+        ok &= collect(argv[i], true);
+    }
+
+    pthread_t pool[MAX_THREADS];
+    long started = 0;
+    while (started < threads && (size_t)started < ntasks &&
+           pthread_create(&pool[started], NULL, worker, NULL) == 0) started++;
+    if (started == 0) worker(NULL);
+
+    // Print in task order as each one completes
+    bool matched = false;
+    for (size_t i = 0; i < ntasks; i++) {
+        pthread_mutex_lock(&lock);
+        while (!tasks[i].done) pthread_cond_wait(&finished, &lock);
+        pthread_mutex_unlock(&lock);
+
+        task_t* t = &tasks[i];
+        if (t->failed) {
+            fprintf(stderr, "sno_grep: %s: cannot read\n", t->path);
+            ok = false;
+        }
+        if (t->len) fwrite(t->out, 1, t->len, stdout);
+        matched |= t->matches > 0;
+        free(t->out);
+        free(t->path);
+    }
+    for (long i = 0; i < started; i++) pthread_join(pool[i], NULL);
+    free(tasks);
+
+    if (!ok) return 2;
+    return matched ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file sno_phf.c
+ * @brief Build-time perfect hash generator for SNO keyword tables (host tool)
+ *
+ * Reads one keyword per line and writes a C header defining keyword ids and
+ * a const sno_keywords_t table for sno_keyword()/kwd() in SNO/sno_keyword.h.
+ * Fails on a line too long for LINE_MAX_LEN and on keywords whose ids would
+ * clash (the id upper-cases the keyword, anything not alphanumeric is '_').
+ *
+ * Usage:   sno_phf NAME < keywords.txt > name_kw.h
+ * Build:   cc -I../SNO -o sno_phf sno_phf.c ../SNO/sno_keyword.c ../SNO/sno_core.c
+ *
+ * @author Jeremy Simon Thornton
+ * @copyright Copyright (c) 2026 Jeremy Simon Thornton
+ * @license MIT License — see LICENSE file for full terms
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "../SNO/sno_keyword.h"
+
+#define LINE_MAX_LEN 128
+
+static void emit_bytes(const char* name, const char* table, const uint8_t* bytes, unsigned int n) {
+    printf("static const uint8_t %s_%s[%u] = {", name, table, n);
+    for (unsigned int i = 0; i < n; i++)
+        printf("%s%3u%s", i % 16 ? " " : "\n    ", bytes[i], i + 1 < n ? "," : "");
+    printf("\n};\n\n");
+}
+
+// A keyword character as it appears in the id
+static int id_char(char c) {
+    return isalnum((unsigned char)c) ? toupper((unsigned char)c) : '_';
+}
+
+// True if keywords a and b give the same id
+static bool same_id(const char* a, const char* b) {
+    while (*a && *b && id_char(*a) == id_char(*b)) {
+        a++;
+        b++;
+    }
+    return !*a && !*b;
+}
+
+static void emit_id(const char* name, const char* word) {
+    printf("    ");
+    for (const char* p = name; *p; p++) putchar(toupper((unsigned char)*p));
+    putchar('_');
+    for (const char* p = word; *p; p++) putchar(id_char(*p));
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s NAME < keywords.txt > name_kw.h\n", argv[0]);
+        return 2;
+    }
+    const char* name = argv[1];
+
+    static char text[SNO_KEYWORD_MAX][LINE_MAX_LEN];
+    const char* words[SNO_KEYWORD_MAX];
+    unsigned int count = 0;
+    char line[LINE_MAX_LEN];
+
+    unsigned int number = 0;
+    while (fgets(line, sizeof(line), stdin)) {
+        number++;
+        if (!strchr(line, '\n')) {
+            int c = getchar();
+            if (c != EOF && c != '\n') {   // not a last line without '\n', nor one that just fit
+                fprintf(stderr, "%s: line %u too long (keywords up to %d characters)\n", argv[0], number, LINE_MAX_LEN - 2);
+                return 1;
+            }
+        }
+        line[strcspn(line, "\r\n")] = '\0';
+        if (!line[0] || line[0] == '#') continue;   // blank lines and comments
+        if (count == SNO_KEYWORD_MAX) {
+            fprintf(stderr, "%s: more than %d keywords\n", argv[0], SNO_KEYWORD_MAX);
+            return 1;
+        }
+        for (unsigned int i = 0; i <= count; i++) {
+            const char* other = (i < count) ? words[i] : "COUNT";     // NAME_COUNT ends the enum
+            if (same_id(line, other)) {
+                fprintf(stderr, "%s: line %u: \"%s\" gives the same id as \"%s\"\n", argv[0], number, line, other);
+                return 1;
+            }
+        }
+        strcpy(text[count], line);
+        words[count] = text[count];
+        count++;
+    }
+
+    uint8_t disp[SNO_KEYWORD_SLOTS], slots[SNO_KEYWORD_SLOTS];
+    sno_keywords_t kw;
+    if (!sno_keywords_build(&kw, words, count, disp, slots)) {
+        fprintf(stderr, "%s: no perfect hash (empty list or duplicate keywords?)\n", argv[0]);
+        return 1;
+    }
+
+    printf("/* Generated by sno_phf from %u keywords - do not edit */\n", count);
+    printf("#include \"sno_keyword.h\"\n\n");
+
+    printf("enum {\n");
+    for (unsigned int i = 0; i < count; i++) {
+        emit_id(name, words[i]);
+        printf(" = %u,\n", i);
+    }
+    printf("    ");
+    for (const char* p = name; *p; p++) putchar(toupper((unsigned char)*p));
+    printf("_COUNT = %u\n};\n\n", count);
+
+    emit_bytes(name, "disp", disp, kw.buckets);
+    emit_bytes(name, "slots", slots, kw.mask + 1u);
+
+    printf("static const char* const %s_words[%u] = {\n", name, count);
+    for (unsigned int i = 0; i < count; i++) {
+        printf("    \"");
+        for (const char* p = words[i]; *p; p++) {
+            if (*p == '"' || *p == '\\') putchar('\\');
+            putchar(*p);
+        }
+        printf("\"%s\n", i + 1 < count ? "," : "");
+    }
+    printf("};\n\n");
+
+    printf("static const sno_keywords_t %s_keywords = {\n", name);
+    printf("    %u, %u, %u, %s_disp, %s_slots, %s_words\n};\n",
+           kw.seed, kw.buckets, kw.mask, name, name, name);
+    return 0;
+}
@@ -1,10 +1,13 @@
 #ifdef USE_DOSLIBC
     #include "STD/dos_stdio.h"
+    #include "STD/dos_stdlib.h"
 #else
     #include <stdio.h>
+    #include <stdlib.h>
 #endif
 
 //#include "TEST/test_bios.h"
+//#include "TEST/test_bios_video.h"
 //#include "TEST/test_dos_memory.h"
 //#include "TEST/test_dos_services.h"
 //#include "TEST/test_dos_files.h"
@@ -14,6 +17,18 @@
 #include "TEST/test_stdlib.h"
 //#include "TEST/test_sno_core.h"
 //#include "TEST/test_sno_extra.h"
+//#include "TEST/test_sno_keyword.h"
+//#include "TEST/test_sno_intern.h"
+//#include "TEST/test_sno_tree.h"
+//#include "TEST/test_sno_profile.h"
+//#include "TEST/test_sno_regex.h"
+//#include "TEST/test_sno_scan.h"
+//#include "TEST/test_sno_store.h"
+//#include "TEST/test_sno_optimize.h"
+//#include "TEST/test_sno_utf8.h"
+//#include "TEST/test_sno_csv.h"
+//#include "TEST/test_sno_json.h"
+//#include "TEST/test_sno_lexcache.h"
 
 int main() {
 
@@ -26,10 +41,24 @@ int main() {
     //SNO
     //test_sno_core();
     //test_sno_extra();
+    //test_bal();           // on its own: test_sno_extra() stops at the strdupl asserts first
+    //test_sno_keywords();
+    //test_sno_intern();
+    //test_sno_tree();
+    //test_sno_profile();
+    //test_sno_regex();
+    //test_sno_scan();
+    //test_sno_store();
+    //test_sno_optimize();
+    //test_sno_utf8();
+    //test_sno_csv();
+    //test_sno_json();
+    //test_sno_lexcache();
 
     // BIOS
     //test_bios_memory();
     //test_bios_keys();
+    //test_bios_video();
 
     // DOS
     //test_dos_memory();
@@ -44,4 +73,5 @@ int main() {
         test_files();
     #endif
 
+    exit(0);    // runs the atexit handlers: flushes the streams and leaves the console cooked
 }